@@ -59,6 +59,7 @@ cmake -DANDROID_NDK=${ANDROID_NDK} \
       -DZUECI_SANITIZE=OFF\
       -DZUECI_TEST=OFF\
       -DZUECI_TEST_ICONV=OFF\
+      -DZUECI_ECIS="${ZUECI_ECIS:-ALL}"\
       -DZUECI_STATIC=ON\
       ..
 
@@ -97,6 +98,7 @@ cmake -DANDROID_NDK=${ANDROID_NDK} \
       -DZUECI_SANITIZE=OFF\
       -DZUECI_TEST=OFF\
       -DZUECI_TEST_ICONV=OFF\
+      -DZUECI_ECIS="${ZUECI_ECIS:-ALL}"\
       -DZUECI_STATIC=ON\
       ..
 
@@ -40,6 +40,7 @@ cmake -DOHOS_NDK=${OHOS_NDK} \
       -DZUECI_SANITIZE=OFF\
       -DZUECI_TEST=OFF\
       -DZUECI_TEST_ICONV=OFF\
+      -DZUECI_ECIS="${ZUECI_ECIS:-ALL}"\
       -DZUECI_STATIC=ON\
       .. -G "Ninja"
 
@@ -77,6 +78,7 @@ cmake -DOHOS_NDK=${OHOS_NDK} \
       -DZUECI_SANITIZE=OFF\
       -DZUECI_TEST=OFF\
       -DZUECI_TEST_ICONV=OFF\
+      -DZUECI_ECIS="${ZUECI_ECIS:-ALL}"\
       -DZUECI_STATIC=ON\
       .. -G "Ninja"
 
@@ -0,0 +1,185 @@
+/* Test a build of a subset of ECIs (CMake option `ZUECI_ECIS`) */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include "zueci_testcommon.h"
+
+/* Built with the library's `ZUECI_ECIS_MASK`, see "tests/CMakeLists.txt" */
+typedef char zueci_static_assert_ecis_mask_set[ZUECI_ECIS_BUILT == ~0ULL ? -1 : 1];
+
+static const int all_ecis[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 170, 899
+};
+
+/* Check each valid ECI converts "AB" if built, and returns ZUECI_ERROR_INVALID_ECI if not */
+static void test_built(const testCtx *const p_ctx) {
+
+    const int data_size = ZUECI_ASIZE(all_ecis);
+    int i, ret, expected_ret, built_cnt = 0;
+    unsigned char dest[16];
+    int dest_len;
+
+    testStart("test_built");
+
+    for (i = 0; i < data_size; i++) {
+        const int eci = all_ecis[i];
+        const int built = (ZUECI_ECIS_BUILT & ZUECI_ECI_BIT(eci)) != 0;
+        /* "AB" in the ECI (UTF-16/32 wider) */
+        const unsigned char *const src = TU(eci == 25 ? "\x00" "A\x00" "B" : eci == 33 ? "A\x00" "B\x00"
+                                            : eci == 34 ? "\x00\x00\x00" "A\x00\x00\x00" "B"
+                                            : eci == 35 ? "A\x00\x00\x00" "B\x00\x00\x00" : "AB");
+        const int src_len = eci == 25 || eci == 33 ? 4 : eci == 34 || eci == 35 ? 8 : 2;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        built_cnt += built;
+        expected_ret = built ? 0 : ZUECI_ERROR_INVALID_ECI;
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        dest_len = -1;
+        ret = zueci_dest_len_eci(eci, TU("AB"), 2, &dest_len);
+        assert_equal(ret, expected_ret, "i:%d eci %d zueci_dest_len_eci ret %d != %d\n", i, eci, ret, expected_ret);
+
+        dest_len = -1;
+        ret = zueci_utf8_to_eci(eci, TU("AB"), 2, dest, &dest_len);
+        assert_equal(ret, expected_ret, "i:%d eci %d zueci_utf8_to_eci ret %d != %d\n", i, eci, ret, expected_ret);
+        if (built) {
+            assert_nonzero(dest_len >= 2, "i:%d eci %d zueci_utf8_to_eci dest_len %d < 2\n", i, eci, dest_len);
+        }
+#endif
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+        dest_len = -1;
+        ret = zueci_dest_len_utf8(eci, src, src_len, 0 /*replacement_char*/, 0 /*flags*/, &dest_len);
+        assert_equal(ret, expected_ret, "i:%d eci %d zueci_dest_len_utf8 ret %d != %d\n", i, eci, ret, expected_ret);
+
+        dest_len = -1;
+        ret = zueci_eci_to_utf8(eci, src, src_len, 0 /*replacement_char*/, 0 /*flags*/, dest, &dest_len);
+        assert_equal(ret, expected_ret, "i:%d eci %d zueci_eci_to_utf8 ret %d != %d\n", i, eci, ret, expected_ret);
+        if (built) {
+            assert_equal(dest_len, 2, "i:%d eci %d zueci_eci_to_utf8 dest_len %d != 2\n", i, eci, dest_len);
+            assert_zero(memcmp(dest, "AB", 2), "i:%d eci %d zueci_eci_to_utf8 memcmp != 0\n", i, eci);
+        }
+#endif
+    }
+    assert_nonzero(built_cnt && built_cnt < data_size, "built_cnt %d\n", built_cnt);
+
+    testFinish();
+}
+
+/* Check conversions of the ECIs built */
+static void test_convert(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *utf8;
+        unsigned char *eci_data;
+        int eci_len;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, TU("A\xC3\xA9"), TU("A\xE9"), 2 }, /* U+00E9 e acute */
+        /*  1*/ { 20, TU("\xE3\x80\x80\\"), TU("\x81\x40\x81\x5F"), 4 }, /* U+3000 IDEOGRAPHIC SPACE, backslash */
+        /*  2*/ { 20, TU("\xE4\xBA\x9C"), TU("\x88\x9F"), 2 }, /* U+4E9C (URO) */
+        /*  3*/ { 26, TU("\xF0\x9F\x98\x80"), TU("\xF0\x9F\x98\x80"), 4 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, ret;
+    unsigned char dest[16];
+    int dest_len;
+
+    testStart("test_convert");
+
+    for (i = 0; i < data_size; i++) {
+        const int utf8_len = (int) ustrlen(data[i].utf8);
+
+        if (testContinue(p_ctx, i)) continue;
+
+        if (!(ZUECI_ECIS_BUILT & ZUECI_ECI_BIT(data[i].eci))) {
+            continue;
+        }
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        dest_len = -1;
+        ret = zueci_utf8_to_eci(data[i].eci, data[i].utf8, utf8_len, dest, &dest_len);
+        assert_zero(ret, "i:%d zueci_utf8_to_eci ret %d != 0\n", i, ret);
+        assert_equal(dest_len, data[i].eci_len, "i:%d dest_len %d != %d\n", i, dest_len, data[i].eci_len);
+        assert_zero(memcmp(dest, data[i].eci_data, dest_len), "i:%d zueci_utf8_to_eci memcmp != 0\n", i);
+#endif
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+        dest_len = -1;
+        ret = zueci_eci_to_utf8(data[i].eci, data[i].eci_data, data[i].eci_len, 0 /*replacement_char*/,
+                0 /*flags*/, dest, &dest_len);
+        assert_zero(ret, "i:%d zueci_eci_to_utf8 ret %d != 0\n", i, ret);
+        assert_equal(dest_len, utf8_len, "i:%d dest_len %d != %d\n", i, dest_len, utf8_len);
+        assert_zero(memcmp(dest, data[i].utf8, dest_len), "i:%d zueci_eci_to_utf8 memcmp != 0\n", i);
+#endif
+    }
+
+    testFinish();
+}
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Check the ECI-choosing functions only consider the ECIs built */
+static void test_choose(const testCtx *const p_ctx) {
+
+    int ret, eci, best_eci, dest_len, segs_len, total_len;
+    unsigned long long mask;
+    zueci_segment segs[8];
+    int ecis[2];
+
+    testStart("test_choose");
+
+    (void)p_ctx;
+
+    mask = 0;
+    ret = zueci_utf8_eci_mask(TU("A"), 1, &mask);
+    assert_zero(ret, "zueci_utf8_eci_mask ret %d != 0\n", ret);
+    assert_nonzero(mask == ZUECI_ECIS_BUILT, "zueci_utf8_eci_mask 0x%llX != 0x%llX\n", mask, ZUECI_ECIS_BUILT);
+
+    ret = zueci_utf8_eci_mask(TU("\xE4\xBA\x9C"), 3, &mask); /* U+4E9C (URO) */
+    assert_zero(ret, "zueci_utf8_eci_mask ret %d != 0\n", ret);
+    assert_zero(mask & ~ZUECI_ECIS_BUILT, "zueci_utf8_eci_mask 0x%llX not built\n", mask & ~ZUECI_ECIS_BUILT);
+
+    for (eci = 0; eci <= 35; eci++) {
+        if (eci == 14 || eci == 19 || (ZUECI_ECIS_BUILT & ZUECI_ECI_BIT(eci))) {
+            continue;
+        }
+        ecis[0] = 26;
+        ecis[1] = eci;
+        ret = zueci_best_eci(TU("A"), 1, ecis, 2, &best_eci, &dest_len);
+        assert_equal(ret, ZUECI_ERROR_INVALID_ECI, "eci %d zueci_best_eci ret %d != ZUECI_ERROR_INVALID_ECI\n",
+                    eci, ret);
+
+        ret = zueci_utf8_segment(TU("A"), 1, ecis, 2, 2 /*switch_cost*/, segs, &segs_len, &total_len);
+        assert_equal(ret, ZUECI_ERROR_INVALID_ECI,
+                    "eci %d zueci_utf8_segment ret %d != ZUECI_ERROR_INVALID_ECI\n", eci, ret);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+int main(int argc, char *argv[]) {
+
+    testFunction funcs[] = { /* name, func */
+        { "test_built", test_built },
+        { "test_convert", test_convert },
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        { "test_choose", test_choose },
+#endif
+    };
+
+    testRun(argc, argv, funcs, ZUECI_ASIZE(funcs));
+
+    testReport();
+
+    return 0;
+}
+
+/* vim: set ts=4 sw=4 et norl : */
@@ -6,6 +6,9 @@
 /* SPDX-License-Identifier: BSD-3-Clause */
 
 #include "zueci_testcommon.h"
+#include <assert.h>
+#include <time.h>
+#include "../zueci_gb18030.h"
 #ifdef ZUECI_TEST_ICONV
 #include <errno.h>
 #include <iconv.h>
@@ -38,6 +41,9 @@ static void test_utf8_to_eci(const testCtx *const p_ctx) {
         /* 12*/ { TU("\xEF\xA8\xAA"), -1, 0, 4 }, /* U+FA2A CJK -> 0x84309C38 */
         /* 13*/ { TU("A\xC2\xA4\xE9\xBD\x84\xE9\xBD\x85~\xE3\x80\x80\x7F\xC2\xA7\xEF\xA8\xA9\xEF\xA8\xAA"), -1, 0, 19 }, /* Multiple (good) mappings */
         /* 14*/ { TU("\xE2\x82\xAC"), -1, 0, 2 }, /* U+20AC EURO SIGN */
+        /* 15*/ { TU("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmn\xE3\x80\x80opqrstuvwxyz0123456789!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~\xC2\x80"), -1, 0, 100 }, /* Long ASCII runs */
+        /* 16*/ { TU("0123456789012345678901234567890\xED\xA0\x80"), -1, ZUECI_ERROR_INVALID_UTF8, -1 }, /* ASCII run then U+D800 */
+        /* 17*/ { TU("\xD8\xA6\xE0\xBD\x80\xC7\x91\xEE\x9F\x88"), -1, 0, 16 }, /* U+0626 U+0F40 U+01D1 U+E7C8 -> 0x81318338 0x8132EE38 0x81309F37 0x8336C830 */
     };
     int data_size = ZUECI_ASIZE(data);
     int i, src_len, ret;
@@ -209,6 +215,10 @@ static void test_eci_to_utf8(const testCtx *const p_ctx) {
         /* 35*/ { TU("\xA4\xFF~\xA1\xA7\xE1\xC0;\xA4\xF3\xA4\x7F\x7F"), -1, 0xFFFD, 0, ZUECI_WARN_INVALID_DATA, 17 }, /* -> U+FFFD ~ U+00AE U+5D02 ; U+3093 U+FFFD <DEL> */
         /* 36*/ { TU("A\xE3\x32\x9A\x36\xA1\xA7G"), -1, 0x00BF, 0, ZUECI_WARN_INVALID_DATA, 6 }, /* -> A U+00BF U+00A8 G */
         /* 37*/ { TU("\xA2\xE3"), -1, 0, 0, 0, 3 }, /* U+20AC (EURO SIGN) */
+        /* 38*/ { TU("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmn\xA1\xA7opqrstuvwxyz0123456789!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~\x82\x35\x8F\x33"), -1, 0, 0, 0, 99 }, /* Long ASCII runs */
+        /* 39*/ { TU("0123456789012345678901234567890\xA1"), -1, 0, 0, ZUECI_ERROR_INVALID_DATA, -1 }, /* ASCII run then 0xA1 missing trailing byte */
+        /* 40*/ { TU("0123456789012345678901234567890\xA1"), -1, 0xFFFD, 0, ZUECI_WARN_INVALID_DATA, 34 }, /* ASCII run -> U+FFFD */
+        /* 41*/ { TU("\x81\x31\x83\x38\x81\x32\xEE\x38\x81\x30\x9F\x37\x81\x30\x9F\x35\x83\x36\xC8\x30"), -1, 0, 0, 0, 12 }, /* -> U+0626 U+0F40 U+01D1 U+01CD U+E7C8 */
     };
     int data_size = ZUECI_ASIZE(data);
     int i, src_len, ret;
@@ -469,6 +479,21 @@ static void test_u_gamut(const testCtx *const p_ctx) {
         assert_equal(ret, ret2, "i:%d 0x%04X ret %d != ret2 %d, val 0x%02X%02X, val2 0x%02X%02X\n",
             (int) i, i, ret, ret2, val[0], val[1], val2[0], val2[1]);
 
+        /* zueci_utf8_to_eci() (which uses direct BMP tables if ZUECI_BMP_TABLES) */
+        {
+            unsigned char utf8[5];
+            unsigned char dest[4];
+            int dest_len = 0;
+            const int utf8_len = testConvertUnicodeToUtf8(i, utf8);
+            ret3 = zueci_utf8_to_eci(32, utf8, utf8_len, dest, &dest_len);
+            assert_equal(ret3, ret ? 0 : ZUECI_ERROR_INVALID_DATA,
+                "i:%d 0x%04X zueci_utf8_to_eci ret3 %d (ret %d)\n", (int) i, i, ret3, ret);
+            if (ret) {
+                assert_equal(dest_len, ret, "i:%d 0x%04X dest_len %d != ret %d\n", (int) i, i, dest_len, ret);
+                assert_zero(memcmp(dest, val, ret), "i:%d 0x%04X memcmp(dest, val, %d) != 0\n", (int) i, i, ret);
+            }
+        }
+
         assert_equal(val[0], val2[0],
             "i:%d 0x%04X val[0] 0x%02X != val2[0] 0x%02X, val[1] 0x%02X, val2[1] 0x%02X\n",
             (int) i, i, val[0], val2[0], val[1], val2[1]);
@@ -780,6 +805,181 @@ static void test_gb18030_gamut(const testCtx *const p_ctx) {
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_encode_cache_stats(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int ret;
+        unsigned char *expected;
+        int lookups;
+        int repeats;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 32, TU("ABC"), 0, TU("ABC"), 0, 0 }, /* ASCII not cached */
+        /*  1*/ { 32, TU("\xE4\xB8\xAD\xE4\xB8\xAD\xE6\x96\x87\xE4\xB8\xAD"), 0, TU("\xD6\xD0\xD6\xD0\xCE\xC4\xD6\xD0"), 4, 2 }, /* U+4E2D U+4E2D U+6587 U+4E2D */
+        /*  2*/ { 32, TU("\xC2\x80" "a" "\xC2\x80"), 0, TU("\x81\x30\x81\x30" "a" "\x81\x30\x81\x30"), 2, 1 }, /* U+0080 4-byter */
+        /*  3*/ { 32, TU("\xF0\xA0\x82\x87\xF0\xA0\x82\x87"), 0, TU("\xFE\x51\xFE\x51"), 2, 1 }, /* U+20087 non-BMP 2-byter */
+        /*  4*/ { 31, TU("\xE4\xB8\xAD\xE4\xB8\xAD"), 0, TU("\xD6\xD0\xD6\xD0"), 2, 1 }, /* U+4E2D cached separately for GBK */
+        /*  5*/ { 31, TU("\xC2\x80"), ZUECI_ERROR_INVALID_DATA, NULL, 1, 0 }, /* Unmapped */
+        /*  6*/ { 31, TU("\xC2\x80"), ZUECI_ERROR_INVALID_DATA, NULL, 1, 1 }, /* Unmapped cached */
+    };
+    int data_size = ZUECI_ASIZE(data);
+    int i, ret;
+
+    unsigned char dest[64];
+    int dest_len;
+    unsigned long long hits, misses;
+    int cached;
+
+    testStart("test_encode_cache_stats");
+
+    ret = zueci_encode_cache_stats(NULL, &misses, 0);
+    assert_equal(ret, ZUECI_ERROR_INVALID_ARGS, "zueci_encode_cache_stats(NULL) ret %d != ZUECI_ERROR_INVALID_ARGS\n",
+        ret);
+    ret = zueci_encode_cache_stats(&hits, NULL, 0);
+    assert_equal(ret, ZUECI_ERROR_INVALID_ARGS, "zueci_encode_cache_stats(NULL) ret %d != ZUECI_ERROR_INVALID_ARGS\n",
+        ret);
+
+    /* Whether built with cache (`ZUECI_ENCODE_CACHE` private to library) */
+    ret = zueci_utf8_to_eci(32, TU("\xE4\xB8\xAD"), 3, dest, &dest_len);
+    assert_zero(ret, "zueci_utf8_to_eci ret %d != 0\n", ret);
+    ret = zueci_encode_cache_stats(&hits, &misses, 0);
+    assert_zero(ret, "zueci_encode_cache_stats ret %d != 0\n", ret);
+    cached = hits + misses != 0;
+
+    for (i = 0; i < data_size; i++) {
+        const int src_len = (int) ustrlen(data[i].data);
+
+        if (testContinue(p_ctx, i)) continue;
+
+        ret = zueci_encode_cache_stats(&hits, &misses, 1 /*reset*/);
+        assert_zero(ret, "i:%d zueci_encode_cache_stats ret %d != 0\n", i, ret);
+        ret = zueci_encode_cache_stats(&hits, &misses, 0);
+        assert_zero(ret, "i:%d zueci_encode_cache_stats ret %d != 0\n", i, ret);
+        assert_zero(hits, "i:%d hits %llu != 0 after reset\n", i, hits);
+        assert_zero(misses, "i:%d misses %llu != 0 after reset\n", i, misses);
+
+        ret = zueci_utf8_to_eci(data[i].eci, data[i].data, src_len, dest, &dest_len);
+        assert_equal(ret, data[i].ret, "i:%d zueci_utf8_to_eci ret %d != %d\n", i, ret, data[i].ret);
+        if (ret == 0) {
+            const int expected_len = (int) ustrlen(data[i].expected);
+            assert_equal(dest_len, expected_len, "i:%d dest_len %d != %d\n", i, dest_len, expected_len);
+            assert_zero(memcmp(dest, data[i].expected, expected_len), "i:%d memcmp != 0\n", i);
+        }
+
+        ret = zueci_encode_cache_stats(&hits, &misses, 0);
+        assert_zero(ret, "i:%d zueci_encode_cache_stats ret %d != 0\n", i, ret);
+        if (cached) {
+            /* Earlier items may already be cached, so only repeats within an item are certain hits */
+            assert_equal((int) (hits + misses), data[i].lookups, "i:%d lookups %d != %d\n",
+                i, (int) (hits + misses), data[i].lookups);
+            assert_nonzero((int) hits >= data[i].repeats, "i:%d hits %d < repeats %d\n",
+                i, (int) hits, data[i].repeats);
+        } else {
+            assert_zero(hits + misses, "i:%d hits %llu + misses %llu != 0\n", i, hits, misses);
+        }
+    }
+
+    testFinish();
+}
+
+/* Binary search of `key` in sorted `keys` of size `size`, returning index or -1 (what the perfect hash replaced) */
+static int perf_bsearch(const zueci_u16 keys[], const int size, const zueci_u32 key) {
+    int s = 0;
+    int e = size - 1;
+    while (s <= e) {
+        const int m = (s + e) >> 1;
+        if (keys[m] < key) {
+            s = m + 1;
+        } else if (keys[m] > key) {
+            e = m - 1;
+        } else {
+            return m;
+        }
+    }
+    return -1;
+}
+
+static int perf_cmp_u16(const void *a, const void *b) {
+    return *(const zueci_u16 *) a - *(const zueci_u16 *) b;
+}
+
+/* Time `ZUECI_GB18030_PHASH()` against binary search on the hashed table `keys` of size `size` with
+   displacements `d`, looking up alternately a key and the next value up (mostly misses). Returns 1 if both agree */
+static int perf_2_lookup(const char *name, const zueci_u16 keys[], const int size, const zueci_u16 d[],
+                const int repeat) {
+    zueci_u16 sorted[ZUECI_ASIZE(zueci_gb18030_2_u_u)]; /* The only table hashed */
+    clock_t start;
+    clock_t diff_phash, diff_bsearch;
+    int hits_phash = 0, hits_bsearch = 0;
+    int i, j;
+
+    assert(size <= ZUECI_ASIZE(sorted));
+    memcpy(sorted, keys, sizeof(zueci_u16) * size);
+    qsort(sorted, size, sizeof(zueci_u16), perf_cmp_u16);
+
+    start = clock();
+    for (j = 0; j < repeat; j++) {
+        for (i = 0; i < size; i++) {
+            const zueci_u32 key = sorted[i] + (i & 1);
+            hits_phash += keys[ZUECI_GB18030_PHASH(key, d, size)] == key;
+        }
+    }
+    diff_phash = clock() - start;
+
+    start = clock();
+    for (j = 0; j < repeat; j++) {
+        for (i = 0; i < size; i++) {
+            const zueci_u32 key = sorted[i] + (i & 1);
+            hits_bsearch += perf_bsearch(sorted, size, key) != -1;
+        }
+    }
+    diff_bsearch = clock() - start;
+
+    printf("%s (%d lookups): phash %.2fms, bsearch %.2fms (hits %d, %d)\n", name, size * repeat,
+            diff_phash * 1000.0 / CLOCKS_PER_SEC, diff_bsearch * 1000.0 / CLOCKS_PER_SEC, hits_phash, hits_bsearch);
+
+    return hits_phash == hits_bsearch;
+}
+
+/* Perfect hash vs binary search for the 2-byte extension Unicode table ("-d 256") */
+static void test_perf_2_lookup(const testCtx *const p_ctx) {
+    const int repeat = 20000;
+    int ret;
+
+    if (!(p_ctx->debug & ZUECI_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    testStart("test_perf_2_lookup");
+
+    ret = perf_2_lookup("zueci_gb18030_2_u_u", zueci_gb18030_2_u_u, ZUECI_ASIZE(zueci_gb18030_2_u_u),
+            zueci_gb18030_2_u_d, repeat);
+    assert_nonzero(ret, "zueci_gb18030_2_u_u phash/bsearch hits differ\n");
+
+    testFinish();
+}
+
+/* Encode vs binary search of the same mappings over the `test_u_gamut()` range ("-d 256") */
+static void test_perf_u_gamut(const testCtx *const p_ctx) {
+    int ret;
+
+    if (!(p_ctx->debug & ZUECI_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    testStart("test_perf_u_gamut");
+
+    ret = testPerfUGamut("zueci_u_gb18030", zueci_u_gb18030_test, 0x10400, 100);
+    assert_nonzero(ret, "zueci_u_gb18030/bsearch outputs differ\n");
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -794,6 +994,11 @@ int main(int argc, char *argv[]) {
 #endif
 #ifndef ZUECI_EMBED_NO_TO_UTF8
         { "test_gb18030_gamut", test_gb18030_gamut },
+#endif
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        { "test_encode_cache_stats", test_encode_cache_stats },
+        { "test_perf_2_lookup", test_perf_2_lookup },
+        { "test_perf_u_gamut", test_perf_u_gamut },
 #endif
     };
 
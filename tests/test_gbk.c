@@ -396,6 +396,21 @@ static void test_u_gamut(const testCtx *const p_ctx) {
         ret2 = u_gbk_2(i, val2);
         assert_equal(ret, ret2, "i:%d 0x%04X ret %d != ret2 %d, val 0x%02X%02X, val2 0x%02X%02X\n",
             (int) i, i, ret, ret2, val[0], val[1], val2[0], val2[1]);
+
+        /* zueci_utf8_to_eci() (which uses direct BMP tables if ZUECI_BMP_TABLES) */
+        {
+            unsigned char utf8[5];
+            unsigned char dest[4];
+            int dest_len = 0;
+            const int utf8_len = testConvertUnicodeToUtf8(i, utf8);
+            ret3 = zueci_utf8_to_eci(31, utf8, utf8_len, dest, &dest_len);
+            assert_equal(ret3, ret ? 0 : ZUECI_ERROR_INVALID_DATA,
+                "i:%d 0x%04X zueci_utf8_to_eci ret3 %d (ret %d)\n", (int) i, i, ret3, ret);
+            if (ret) {
+                assert_equal(dest_len, ret, "i:%d 0x%04X dest_len %d != ret %d\n", (int) i, i, dest_len, ret);
+                assert_zero(memcmp(dest, val, ret), "i:%d 0x%04X memcmp(dest, val, %d) != 0\n", (int) i, i, ret);
+            }
+        }
         if (ret) {
             assert_equal(val[0], val2[0],
                 "i:%d 0x%04X val[0] 0x%02X != val2[0] 0x%02X, val[1] 0x%02X, val2[1] 0x%02X\n",
@@ -555,6 +570,24 @@ static void test_gbk_gamut(const testCtx *const p_ctx) {
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Encode vs binary search of the same mappings over the `test_u_gamut()` range ("-d 256") */
+static void test_perf_u_gamut(const testCtx *const p_ctx) {
+    int ret;
+
+    if (!(p_ctx->debug & ZUECI_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    testStart("test_perf_u_gamut");
+
+    ret = testPerfUGamut("zueci_u_gbk", zueci_u_gbk_test, 0xFFFE, 100);
+    assert_nonzero(ret, "zueci_u_gbk/bsearch outputs differ\n");
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -569,6 +602,9 @@ int main(int argc, char *argv[]) {
 #endif
 #ifndef ZUECI_EMBED_NO_TO_UTF8
         { "test_gbk_gamut", test_gbk_gamut },
+#endif
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        { "test_perf_u_gamut", test_perf_u_gamut },
 #endif
     };
 
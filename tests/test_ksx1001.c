@@ -531,6 +531,24 @@ static void test_ksx1001_gamut(const testCtx *const p_ctx) {
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Encode vs binary search of the same mappings over the `test_u_gamut()` range ("-d 256") */
+static void test_perf_u_gamut(const testCtx *const p_ctx) {
+    int ret;
+
+    if (!(p_ctx->debug & ZUECI_DEBUG_TEST_PERFORMANCE)) { /* -d 256 */
+        return;
+    }
+
+    testStart("test_perf_u_gamut");
+
+    ret = testPerfUGamut("zueci_u_ksx1001", zueci_u_ksx1001_test, 0xFFFE, 100);
+    assert_nonzero(ret, "zueci_u_ksx1001/bsearch outputs differ\n");
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -545,6 +563,9 @@ int main(int argc, char *argv[]) {
 #endif
 #ifndef ZUECI_EMBED_NO_TO_UTF8
         { "test_ksx1001_gamut", test_ksx1001_gamut },
+#endif
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        { "test_perf_u_gamut", test_perf_u_gamut },
 #endif
     };
 
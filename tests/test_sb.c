@@ -1471,6 +1471,1037 @@ static void test_replacement_char_flags(const testCtx *const p_ctx) {
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+static void test_utf8_valid(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned char *data;
+        int length;
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { TU("\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"), -1, 0 }, /* Boundaries */
+        /*  1*/ { TU("\xED\x9F\xBF\xEE\x80\x80"), -1, 0 }, /* U+D7FF U+E000 */
+        /*  2*/ { TU("\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Lone continuation */
+        /*  3*/ { TU("\xC2\x80\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Too long */
+        /*  4*/ { TU("\xC2"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Incomplete at end */
+        /*  5*/ { TU("\xE2\x82"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Incomplete at end */
+        /*  6*/ { TU("\xF0\x9F\x98"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Incomplete at end */
+        /*  7*/ { TU("\xC2G"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Too short */
+        /*  8*/ { TU("\xF0\x9F\x98G"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Too short */
+        /*  9*/ { TU("\xC0\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Overlong 2-byte */
+        /* 10*/ { TU("\xC1\xBF"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Overlong 2-byte */
+        /* 11*/ { TU("\xE0\x9F\xBF"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Overlong 3-byte */
+        /* 12*/ { TU("\xF0\x8F\xBF\xBF"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Overlong 4-byte */
+        /* 13*/ { TU("\xED\xA0\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Surrogate U+D800 */
+        /* 14*/ { TU("\xED\xBF\xBF"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Surrogate U+DFFF */
+        /* 15*/ { TU("\xF4\x90\x80\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* U+110000 */
+        /* 16*/ { TU("\xF5\x80\x80\x80"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Too large lead */
+        /* 17*/ { TU("\xFF"), -1, ZUECI_ERROR_INVALID_UTF8 },
+        /* 18*/ { TU("\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC"), -1, 0 }, /* 12 U+20AC */
+        /* 19*/ { TU("\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82\xAC\xE2\x82"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* 11 U+20AC then incomplete */
+        /* 20*/ { TU("\xE2\x82\xAC" "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\xF0\x9F\x98\x80"), -1, 0 }, /* Multibyte, ASCII block, multibyte */
+        /* 21*/ { TU("\xE2\x82" "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"), -1, ZUECI_ERROR_INVALID_UTF8 }, /* Incomplete followed by ASCII blocks */
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, src_len, ret;
+    /* Prefix with varying numbers of ASCII bytes so the data straddles 16/32-byte SIMD block boundaries */
+    static const char prefix[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    const int prefix_len = (int) sizeof(prefix) - 1;
+
+    unsigned char src[1024];
+    unsigned char dest[1024];
+
+    testStart("test_utf8_valid");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src_len = data[i].length != -1 ? data[i].length : (int) ustrlen(data[i].data);
+
+        for (j = 0; j <= prefix_len; j++) {
+            int dest_len = 0;
+
+            memcpy(src, prefix, j);
+            memcpy(src + j, data[i].data, src_len);
+
+            ret = zueci_eci_to_utf8(26, src, j + src_len, 0, 0, dest, &dest_len);
+            assert_equal(ret, data[i].ret, "i:%d j:%d zueci_eci_to_utf8 ret %d != %d\n", i, j, ret, data[i].ret);
+            if (ret == 0) {
+                assert_equal(dest_len, j + src_len, "i:%d j:%d dest_len %d != %d\n", i, j, dest_len, j + src_len);
+                assert_zero(memcmp(dest, src, dest_len), "i:%d j:%d memcmp != 0\n", i, j);
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_stream(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int length;
+        unsigned int replacement_char;
+        unsigned int flags;
+        int ret;
+        unsigned char *expected;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 26, TU("A\xE2\x82\xAC" "B\xF0\x9F\x98\x80" "C"), -1, 0, 0, 0, TU("A\xE2\x82\xAC" "B\xF0\x9F\x98\x80" "C") },
+        /*  1*/ { 26, TU("A\xE2\x82"), -1, 0, 0, ZUECI_ERROR_INVALID_UTF8, NULL }, /* Incomplete at end */
+        /*  2*/ { 26, TU("A\xE2\x82"), -1, 0xFFFD, 0, ZUECI_WARN_INVALID_DATA, TU("A\xEF\xBF\xBD") },
+        /*  3*/ { 26, TU("\xE2\x82G\xC3\x80\x80\x80H"), -1, '?', 0, ZUECI_WARN_INVALID_DATA, TU("?G\xC3\x80?H") }, /* Continuation bytes skipped */
+        /*  4*/ { 26, TU("\xC0\x80"), -1, 0, 0, ZUECI_ERROR_INVALID_UTF8, NULL },
+        /*  5*/ { 32, TU("A\x82\x35\x8F\x33\xA1\xA7" "B"), -1, 0, 0, 0, TU("A\xE9\xBE\xA6\xC2\xA8" "B") }, /* U+9FA6 U+00A8 */
+        /*  6*/ { 32, TU("\x81\x30\x81"), -1, 0, 0, ZUECI_ERROR_INVALID_DATA, NULL }, /* 4-byter missing trailing byte */
+        /*  7*/ { 32, TU("\x81\x30\x81"), -1, 0xFFFD, 0, ZUECI_WARN_INVALID_DATA, TU("\xEF\xBF\xBD\xEF\xBF\xBD") },
+        /*  8*/ { 32, TU("\x81\x30GHI"), -1, '?', 0, ZUECI_WARN_INVALID_DATA, TU("?I") }, /* Treated as 4-byter */
+        /*  9*/ { 32, TU("\x80\x40G"), -1, '?', 0, ZUECI_WARN_INVALID_DATA, TU("?G") },
+        /* 10*/ { 25, TU("\x00" "A\xD8\x3D\xDE\x00\x00" "B"), 8, 0, 0, 0, TU("A\xF0\x9F\x98\x80" "B") }, /* Surrogate pair */
+        /* 11*/ { 33, TU("A\x00\x3D\xD8\x00\xDE"), 6, 0, 0, 0, TU("A\xF0\x9F\x98\x80") },
+        /* 12*/ { 33, TU("A\x00\x3D\xD8"), 4, '?', 0, ZUECI_WARN_INVALID_DATA, TU("A?") }, /* Lone high surrogate at end */
+        /* 13*/ { 34, TU("\x00\x01\xF6\x00\x00\x00\x00"), 7, 0, 0, ZUECI_ERROR_INVALID_DATA, NULL }, /* Incomplete at end */
+        /* 14*/ { 35, TU("\x00\xF6\x01\x00" "A\x00\x00\x00"), 8, 0, 0, 0, TU("\xF0\x9F\x98\x80" "A") },
+        /* 15*/ { 3, TU("A\xE9\x80"), -1, '?', 0, ZUECI_WARN_INVALID_DATA, TU("A\xC3\xA9?") },
+        /* 16*/ { 899, TU("\x7F\xFF"), -1, 0, 0, 0, TU("\x7F\xC3\xBF") },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, k, src_len, ret;
+
+    unsigned char dest[1024];
+
+    testStart("test_stream");
+
+    for (i = 0; i < data_size; i++) {
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src_len = data[i].length != -1 ? data[i].length : (int) ustrlen(data[i].data);
+
+        /* Split into chunks of `j` bytes, with `j` zero meaning 2 chunks split at each position `k` */
+        for (j = 0; j <= 3; j++) {
+            for (k = 0; k <= (j ? 0 : src_len); k++) {
+                zueci_stream stream;
+                int pos = 0, chunk = 0, dest_len = 0, ret_all = 0;
+
+                ret = zueci_stream_init(&stream, data[i].eci, data[i].replacement_char, data[i].flags);
+                assert_zero(ret, "i:%d zueci_stream_init ret %d != 0\n", i, ret);
+
+                ret = 0;
+                while ((pos < src_len || !chunk) && ret < ZUECI_ERROR) {
+                    const int len = j ? ZUECI_MIN(j, src_len - pos) : chunk ? src_len - pos : k;
+                    int chunk_dest_len = 0;
+                    ret = zueci_stream_feed(&stream, data[i].data + pos, len, dest + dest_len, &chunk_dest_len);
+                    if (ret < ZUECI_ERROR) {
+                        dest_len += chunk_dest_len;
+                        ret_all |= ret;
+                    }
+                    pos += len;
+                    chunk++;
+                }
+                if (ret < ZUECI_ERROR) {
+                    int chunk_dest_len = 0;
+                    ret = zueci_stream_finish(&stream, dest + dest_len, &chunk_dest_len);
+                    if (ret < ZUECI_ERROR) {
+                        dest_len += chunk_dest_len;
+                        ret = ret_all | ret;
+                    }
+                }
+                assert_equal(ret, data[i].ret, "i:%d j:%d k:%d ret %d != %d\n", i, j, k, ret, data[i].ret);
+                if (ret < ZUECI_ERROR) {
+                    const int expected_length = (int) ustrlen(data[i].expected);
+                    assert_equal(dest_len, expected_length, "i:%d j:%d k:%d dest_len %d != %d\n",
+                        i, j, k, dest_len, expected_length);
+                    assert_zero(memcmp(dest, data[i].expected, dest_len), "i:%d j:%d k:%d memcmp != 0\n", i, j, k);
+                }
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_eci_to_utf8_bounded(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int length;
+        unsigned int replacement_char;
+        int dest_size;
+        int ret;
+        int expected_src_used;
+        int expected_dest_len;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, TU("AB\xE9"), -1, 0, 4, 0, 3, 4 },
+        /*  1*/ { 3, TU("AB\xE9"), -1, 0, 3, ZUECI_WARN_DEST_FULL, 2, 2 }, /* U+00E9 needs 2 */
+        /*  2*/ { 3, TU("AB\x80"), -1, 0xFFFD, 4, ZUECI_WARN_DEST_FULL, 2, 2 }, /* Replacement needs 3 */
+        /*  3*/ { 3, TU("AB\x80"), -1, 0xFFFD, 5, ZUECI_WARN_INVALID_DATA, 3, 5 },
+        /*  4*/ { 3, TU("AB\x80"), -1, 0, 5, ZUECI_ERROR_INVALID_DATA, -1, -1 },
+        /*  5*/ { 26, TU("A\xE2\x82\xAC" "B"), -1, 0, 3, ZUECI_WARN_DEST_FULL, 1, 1 },
+        /*  6*/ { 26, TU("A\xE2\x82\xAC" "B"), -1, 0, 4, ZUECI_WARN_DEST_FULL, 4, 4 },
+        /*  7*/ { 26, TU("A\xE2\x82"), -1, 0xFFFD, 3, ZUECI_WARN_DEST_FULL, 1, 1 }, /* Incomplete at end */
+        /*  8*/ { 26, TU("A\xE2\x82"), -1, 0xFFFD, 4, ZUECI_WARN_INVALID_DATA, 3, 4 },
+        /*  9*/ { 32, TU("A\x82\x35\x8F\x33" "B"), -1, 0, 3, ZUECI_WARN_DEST_FULL, 1, 1 }, /* U+9FA6 needs 3 */
+        /* 10*/ { 32, TU("A\x82\x35\x8F\x33" "B"), -1, 0, 4, ZUECI_WARN_DEST_FULL, 5, 4 },
+        /* 11*/ { 32, TU("A\x82\x35\x8F\x33" "B"), -1, 0, 5, 0, 6, 5 },
+        /* 12*/ { 32, TU("A\x82\x35\x8F"), -1, '?', 3, ZUECI_WARN_INVALID_DATA, 4, 3 }, /* Incomplete at end -> 2 replacements */
+        /* 13*/ { 32, TU("A\x82\x35\x8F\x33" "B"), -1, 0, 0, ZUECI_WARN_DEST_FULL, 0, 0 },
+        /* 14*/ { 33, TU("A\x00\x3D\xD8\x00\xDE"), 6, 0, 4, ZUECI_WARN_DEST_FULL, 2, 1 }, /* Surrogate pair needs 4 */
+        /* 15*/ { 899, TU("\x7F\xFF"), -1, 0, 2, ZUECI_WARN_DEST_FULL, 1, 1 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, src_len, ret;
+
+    unsigned char dest[1024];
+    unsigned char expected[1024];
+
+    testStart("test_eci_to_utf8_bounded");
+
+    for (i = 0; i < data_size; i++) {
+        int src_used = -1, dest_len = -1, expected_len = 0, ret_all;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src_len = data[i].length != -1 ? data[i].length : (int) ustrlen(data[i].data);
+
+        ret = zueci_eci_to_utf8_bounded(data[i].eci, data[i].data, src_len, data[i].replacement_char, 0, dest,
+                data[i].dest_size, &src_used, &dest_len);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        if (ret >= ZUECI_ERROR) {
+            continue;
+        }
+        assert_equal(src_used, data[i].expected_src_used, "i:%d src_used %d != %d\n",
+            i, src_used, data[i].expected_src_used);
+        assert_equal(dest_len, data[i].expected_dest_len, "i:%d dest_len %d != %d\n",
+            i, dest_len, data[i].expected_dest_len);
+
+        /* Continue until done (enlarging if no room for a single character) and check same as one-shot */
+        ret_all = ret;
+        while (ret == ZUECI_WARN_DEST_FULL) {
+            const int total_src_used = src_used, total_dest_len = dest_len;
+            const int dest_size = data[i].dest_size < 4 ? 4 : data[i].dest_size;
+            ret = zueci_eci_to_utf8_bounded(data[i].eci, data[i].data + src_used, src_len - src_used,
+                    data[i].replacement_char, 0, dest + dest_len, dest_size, &src_used, &dest_len);
+            assert_zero(ret >= ZUECI_ERROR, "i:%d ret %d >= ZUECI_ERROR\n", i, ret);
+            src_used += total_src_used;
+            dest_len += total_dest_len;
+            ret_all |= ret;
+        }
+        assert_equal(src_used, src_len, "i:%d src_used %d != src_len %d\n", i, src_used, src_len);
+
+        ret = zueci_eci_to_utf8(data[i].eci, data[i].data, src_len, data[i].replacement_char, 0, expected,
+                &expected_len);
+        assert_zero(ret >= ZUECI_ERROR, "i:%d zueci_eci_to_utf8 ret %d >= ZUECI_ERROR\n", i, ret);
+        assert_equal(dest_len, expected_len, "i:%d dest_len %d != expected_len %d\n", i, dest_len, expected_len);
+        assert_zero(memcmp(dest, expected, dest_len), "i:%d memcmp != 0\n", i);
+    }
+
+    testFinish();
+}
+
+/* Counting `zueci_realloc_func` for `test_eci_to_utf8_alloc()` */
+static void *test_realloc(void *ctx, void *ptr, const int size) {
+    int *p_cnt = (int *) ctx;
+    if (size == 0) {
+        free(ptr);
+        p_cnt[1]++;
+        return NULL;
+    }
+    p_cnt[0]++;
+    return realloc(ptr, (size_t) size);
+}
+
+static void test_eci_to_utf8_alloc(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int repeat;
+        unsigned int replacement_char;
+        int ret;
+        int expected_length;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, TU(""), 1, 0, 0, 0 },
+        /*  1*/ { 3, TU("AB\xE9"), 1, 0, 0, 4 },
+        /*  2*/ { 3, TU("\xE9"), 200, 0, 0, 400 }, /* Needs growing */
+        /*  3*/ { 3, TU("\xE9\x80"), 100, 0xFFFD, ZUECI_WARN_INVALID_DATA, 500 }, /* Needs growing */
+        /*  4*/ { 3, TU("\xE9\x80"), 100, 0, ZUECI_ERROR_INVALID_DATA, -1 },
+        /*  5*/ { 26, TU("A\xE2\x82\xAC"), 100, 0, 0, 400 },
+        /*  6*/ { 26, TU("A\xE2\x82"), 100, '?', ZUECI_WARN_INVALID_DATA, 200 },
+        /*  7*/ { 32, TU("A\x82\x35\x8F\x33\xA1\xA7"), 50, 0, 0, 300 }, /* U+9FA6 U+00A8 */
+        /*  8*/ { 899, TU("\xFF"), 300, 0, 0, 600 }, /* Needs growing */
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, ret;
+
+    unsigned char src[1024];
+    unsigned char expected[4096];
+
+    testStart("test_eci_to_utf8_alloc");
+
+    for (i = 0; i < data_size; i++) {
+        const int len = (int) ustrlen(data[i].data);
+        int src_len = 0, expected_len = 0;
+        int k;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < data[i].repeat; j++) {
+            memcpy(src + src_len, data[i].data, len);
+            src_len += len;
+        }
+
+        /* With default realloc() and counting callback */
+        for (k = 0; k < 2; k++) {
+            unsigned char *dest = NULL;
+            int dest_len = -1;
+            int cnt[2] = { 0, 0 };
+
+            ret = zueci_eci_to_utf8_alloc(data[i].eci, src, src_len, data[i].replacement_char, 0,
+                    k ? test_realloc : NULL, k ? cnt : NULL, &dest, &dest_len);
+            assert_equal(ret, data[i].ret, "i:%d k:%d ret %d != %d\n", i, k, ret, data[i].ret);
+            if (ret < ZUECI_ERROR) {
+                assert_nonnull(dest, "i:%d k:%d dest NULL\n", i, k);
+                assert_equal(dest_len, data[i].expected_length, "i:%d k:%d dest_len %d != %d\n",
+                    i, k, dest_len, data[i].expected_length);
+
+                ret = zueci_eci_to_utf8(data[i].eci, src, src_len, data[i].replacement_char, 0, expected,
+                        &expected_len);
+                assert_equal(ret, data[i].ret, "i:%d k:%d zueci_eci_to_utf8 ret %d != %d\n", i, k, ret, data[i].ret);
+                assert_equal(dest_len, expected_len, "i:%d k:%d dest_len %d != expected_len %d\n",
+                    i, k, dest_len, expected_len);
+                assert_zero(memcmp(dest, expected, dest_len), "i:%d k:%d memcmp != 0\n", i, k);
+                dest[dest_len] = '\0'; /* Room for NUL */
+                if (k) {
+                    assert_nonzero(cnt[0], "i:%d k:%d cnt[0] zero\n", i, k);
+                    assert_zero(cnt[1], "i:%d k:%d cnt[1] %d non-zero\n", i, k, cnt[1]);
+                }
+                free(dest);
+            } else {
+                assert_null(dest, "i:%d k:%d dest not NULL\n", i, k);
+                if (k) {
+                    assert_equal(cnt[1], 1, "i:%d k:%d cnt[1] %d != 1 (not freed)\n", i, k, cnt[1]);
+                }
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_eci_to_utf8_batch(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned int replacement_char;
+        unsigned int flags;
+        int count;
+        unsigned char *data[4];
+        int ret;
+        int expected_rets[4];
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, 0, 0, 0, { NULL }, 0, { 0 } },
+        /*  1*/ { 3, 0, 0, 3, { TU("AB\xE9"), TU(""), TU("\xFF") }, 0, { 0, 0, 0 } },
+        /*  2*/ { 3, 0, 0, 3, { TU("AB\xE9"), TU("\x80"), TU("\xFF") }, ZUECI_ERROR_INVALID_DATA, { 0, ZUECI_ERROR_INVALID_DATA, 0 } },
+        /*  3*/ { 3, '?', 0, 3, { TU("AB\xE9"), TU("\x80"), TU("\xFF") }, ZUECI_WARN_INVALID_DATA, { 0, ZUECI_WARN_INVALID_DATA, 0 } },
+        /*  4*/ { 3, 0, 0, 2, { TU("AB"), NULL }, ZUECI_ERROR_INVALID_ARGS, { 0, ZUECI_ERROR_INVALID_ARGS } },
+        /*  5*/ { 26, 0, 0, 4, { TU("A\xE2\x82\xAC"), TU("\xE2\x82"), TU("\xF0\x9F\x98\x80"), TU("B") }, ZUECI_ERROR_INVALID_UTF8, { 0, ZUECI_ERROR_INVALID_UTF8, 0, 0 } },
+        /*  6*/ { 26, 0xFFFD, 0, 2, { TU("A\xE2\x82"), TU("\xC2\xA9") }, ZUECI_WARN_INVALID_DATA, { ZUECI_WARN_INVALID_DATA, 0 } },
+        /*  7*/ { 32, 0, 0, 3, { TU("\x82\x35\x8F\x33"), TU("\xA1\xA7"), TU("\xA1") }, ZUECI_ERROR_INVALID_DATA, { 0, 0, ZUECI_ERROR_INVALID_DATA } },
+        /*  8*/ { 899, 0, 0, 2, { TU("\x7F\xFF"), TU("\x80") }, 0, { 0, 0 } },
+        /*  9*/ { 1, 0x110000, ZUECI_FLAG_SB_STRAIGHT_THRU, 1, { TU("\x80") }, 0, { 0 } }, /* Replacement unused */
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, ret;
+
+    unsigned char dest[1024];
+    unsigned char expected[1024];
+
+    testStart("test_eci_to_utf8_batch");
+
+    for (i = 0; i < data_size; i++) {
+        int src_lens[4];
+        int dest_offsets[5];
+        int rets[4];
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < data[i].count; j++) {
+            src_lens[j] = data[i].data[j] ? (int) ustrlen(data[i].data[j]) : 0;
+        }
+
+        ret = zueci_eci_to_utf8_batch(data[i].eci, (const unsigned char *const *) data[i].data, src_lens,
+                data[i].count, data[i].replacement_char, data[i].flags, dest, dest_offsets, rets);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+
+        assert_zero(dest_offsets[0], "i:%d dest_offsets[0] %d != 0\n", i, dest_offsets[0]);
+        for (j = 0; j < data[i].count; j++) {
+            const int len = dest_offsets[j + 1] - dest_offsets[j];
+            assert_equal(rets[j], data[i].expected_rets[j], "i:%d j:%d rets[j] %d != %d\n",
+                i, j, rets[j], data[i].expected_rets[j]);
+            if (rets[j] < ZUECI_ERROR) {
+                int expected_len = 0;
+                ret = zueci_eci_to_utf8(data[i].eci, data[i].data[j], src_lens[j], data[i].replacement_char,
+                        data[i].flags, expected, &expected_len);
+                assert_equal(ret, rets[j], "i:%d j:%d zueci_eci_to_utf8 ret %d != %d\n", i, j, ret, rets[j]);
+                assert_equal(len, expected_len, "i:%d j:%d len %d != expected_len %d\n", i, j, len, expected_len);
+                assert_zero(memcmp(dest + dest_offsets[j], expected, len), "i:%d j:%d memcmp != 0\n", i, j);
+            } else {
+                assert_zero(len, "i:%d j:%d len %d != 0\n", i, j, len);
+            }
+        }
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+static void test_eci_to_utf8_mt(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        int random; /* If set, `data` is alphabet to randomly choose from, else repeated */
+        unsigned char *data;
+        int length; /* Of `data`, -1 if NUL-terminated */
+        int src_len;
+        int threads;
+        unsigned int replacement_char;
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 32, 1, TU("\x81\x30\x39\xE3\x84\x31\xA4\xFE" "A \x80\xFF\x7F"), -1, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /*  1*/ { 32, 1, TU("\x81\x30\x39\xE3\x84\x31\xA4\xFE" "A \x80\xFF\x7F"), -1, 300000, 4, 0, ZUECI_ERROR_INVALID_DATA },
+        /*  2*/ { 32, 0, TU("\x81\x30\x81\x30" "A\xB0\xA1 "), -1, 300000, 8, 0, 0 },
+        /*  3*/ { 32, 0, TU("\xB0\xA1"), -1, 300000, 4, 0, 0 }, /* No split points */
+        /*  4*/ { 32, 0, TU("AB"), -1, 10, 4, 0, 0 },
+        /*  5*/ { 32, 1, TU("\x81\x30\x31\x39\x3A\x40" "A"), -1, 300000, 5, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /*  6*/ { 31, 1, TU("\x81\x40\x7E\xA1\xFE A\x80\xFF"), -1, 300000, 3, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /*  7*/ { 31, 0, TU("\xB0\xA1" "AB"), -1, 300000, 3, 0, 0 },
+        /*  8*/ { 29, 1, TU("\xA1\xB0\xF7\xFE A\x80"), -1, 300000, 3, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /*  9*/ { 26, 1, TU("\xC3\xA9\xE2\x82\xAC\xF0\x9F" "A\x80\xBF"), -1, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 10*/ { 26, 0, TU("A\xC3\xA9\xE2\x82\xAC"), -1, 300000, 4, 0, 0 },
+        /* 11*/ { 25, 1, TU("\xD8\xDC\x00" "A\xDF"), 5, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 12*/ { 33, 1, TU("\xD8\xDC\x00" "A\xDF"), 5, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 13*/ { 34, 1, TU("\x00\x01\x10" "A\xD8"), 5, 300001, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 14*/ { 35, 1, TU("\x00\x01\x10" "A\xD8"), 5, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 15*/ { 3, 1, TU("A\x80\xA0\xFF"), -1, 300000, 4, 0xFFFD, ZUECI_WARN_INVALID_DATA },
+        /* 16*/ { 899, 1, TU("A\x80\xFF"), -1, 300000, 64, 0, 0 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, ret, expected_ret;
+    unsigned int rnd = 1;
+
+    testStart("test_eci_to_utf8_mt");
+
+    for (i = 0; i < data_size; i++) {
+        unsigned char *src, *dest, *expected;
+        const int src_len = data[i].src_len;
+        const int len = data[i].length == -1 ? (int) ustrlen(data[i].data) : data[i].length;
+        int dest_len = -1, expected_len = -1;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src = (unsigned char *) malloc(src_len);
+        dest = (unsigned char *) malloc(src_len * 4);
+        expected = (unsigned char *) malloc(src_len * 4);
+        assert_nonnull(src, "i:%d src NULL\n", i);
+        assert_nonnull(dest, "i:%d dest NULL\n", i);
+        assert_nonnull(expected, "i:%d expected NULL\n", i);
+
+        for (j = 0; j < src_len; j++) {
+            if (data[i].random) {
+                rnd = rnd * 1103515245 + 12345;
+                src[j] = data[i].data[(rnd >> 16) % len];
+            } else {
+                src[j] = data[i].data[j % len];
+            }
+        }
+
+        ret = zueci_eci_to_utf8_mt(data[i].eci, src, src_len, data[i].replacement_char, 0 /*flags*/, dest,
+                &dest_len, data[i].threads);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+
+        expected_ret = zueci_eci_to_utf8(data[i].eci, src, src_len, data[i].replacement_char, 0 /*flags*/,
+                        expected, &expected_len);
+        assert_equal(ret, expected_ret, "i:%d ret %d != expected_ret %d\n", i, ret, expected_ret);
+        if (ret < ZUECI_ERROR) {
+            assert_equal(dest_len, expected_len, "i:%d dest_len %d != expected_len %d\n",
+                i, dest_len, expected_len);
+            assert_zero(memcmp(dest, expected, dest_len), "i:%d memcmp != 0\n", i);
+        }
+
+        free(src);
+        free(dest);
+        free(expected);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+ZUECI_INTERN int zueci_mt_split_utf8_test(const int eci, const unsigned char src[], const int src_len,
+                    const int max_cnt, int ends[]);
+
+static void test_eci_to_utf8_mt_split(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        int src_len;
+        int no_split_len; /* Leading length with no split points (double-byte only), rest has ASCII (multiple of 4) */
+        int max_cnt;
+        int expected_cnt;
+        int expected_first_end; /* Minimum of */
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 29, 400000, 0, 4, 4, 100000 },
+        /*  1*/ { 29, 400000, 150000, 4, 3, 200000 }, /* First nominal end skipped, rest still split */
+        /*  2*/ { 29, 400000, 250000, 4, 2, 300000 }, /* First 2 skipped */
+        /*  3*/ { 29, 400000, 400000, 4, 1, 400000 }, /* None */
+        /*  4*/ { 31, 800000, 300000, 8, 6, 300000 },
+        /*  5*/ { 32, 400000, 150000, 4, 3, 200000 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, cnt, ret, dest_len, expected_len, expected_ret;
+    int ends[64];
+
+    testStart("test_eci_to_utf8_mt_split");
+
+    for (i = 0; i < data_size; i++) {
+        unsigned char *src, *dest, *expected;
+        const int src_len = data[i].src_len;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src = (unsigned char *) malloc(src_len);
+        dest = (unsigned char *) malloc(src_len * 4);
+        expected = (unsigned char *) malloc(src_len * 4);
+        assert_nonnull(src, "i:%d src NULL\n", i);
+        assert_nonnull(dest, "i:%d dest NULL\n", i);
+        assert_nonnull(expected, "i:%d expected NULL\n", i);
+
+        for (j = 0; j < data[i].no_split_len; j += 2) {
+            src[j] = 0xB0;
+            src[j + 1] = 0xA1;
+        }
+        for (; j < src_len; j += 4) { /* 2 ASCII so GB 18030 can split also */
+            src[j] = 0xB0;
+            src[j + 1] = 0xA1;
+            src[j + 2] = src[j + 3] = 'A';
+        }
+
+        cnt = zueci_mt_split_utf8_test(data[i].eci, src, src_len, data[i].max_cnt, ends);
+        assert_equal(cnt, data[i].expected_cnt, "i:%d cnt %d != %d\n", i, cnt, data[i].expected_cnt);
+        assert_equal(ends[cnt - 1], src_len, "i:%d ends[%d] %d != src_len %d\n", i, cnt - 1, ends[cnt - 1], src_len);
+        assert_nonzero(ends[0] >= data[i].expected_first_end && ends[0] < data[i].expected_first_end + 4,
+                    "i:%d ends[0] %d != %d (+ 3)\n", i, ends[0], data[i].expected_first_end);
+        for (j = 0; j < cnt - 1; j++) {
+            assert_nonzero(ends[j] < ends[j + 1], "i:%d ends[%d] %d >= ends[%d] %d\n",
+                        i, j, ends[j], j + 1, ends[j + 1]);
+            assert_equal(src[ends[j] - 1], 'A', "i:%d src[ends[%d] - 1] 0x%02X != 'A'\n",
+                        i, j, src[ends[j] - 1]);
+        }
+
+        ret = zueci_eci_to_utf8_mt(data[i].eci, src, src_len, 0 /*replacement_char*/, 0 /*flags*/, dest,
+                &dest_len, data[i].max_cnt);
+        expected_ret = zueci_eci_to_utf8(data[i].eci, src, src_len, 0 /*replacement_char*/, 0 /*flags*/,
+                        expected, &expected_len);
+        assert_zero(expected_ret, "i:%d expected_ret %d != 0\n", i, expected_ret);
+        assert_equal(ret, expected_ret, "i:%d ret %d != expected_ret %d\n", i, ret, expected_ret);
+        assert_equal(dest_len, expected_len, "i:%d dest_len %d != expected_len %d\n", i, dest_len, expected_len);
+        assert_zero(memcmp(dest, expected, dest_len), "i:%d memcmp != 0\n", i);
+
+        free(src);
+        free(dest);
+        free(expected);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_utf8_to_eci_batch(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        int count;
+        unsigned char *data[3];
+        int ret;
+        int expected_rets[3];
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, 3, { TU("AB\xC3\xA9"), TU(""), TU("\xC3\xBF") }, 0, { 0, 0, 0 } },
+        /*  1*/ { 3, 3, { TU("AB"), TU("\xE2\x82\xAC"), TU("\xC3") }, ZUECI_ERROR_INVALID_UTF8, { 0, ZUECI_ERROR_INVALID_DATA, ZUECI_ERROR_INVALID_UTF8 } },
+        /*  2*/ { 32, 2, { TU("\xE9\xBE\xA6"), TU("A\xC2\xA8") }, 0, { 0, 0 } },
+        /*  3*/ { 34, 2, { TU("A"), NULL }, ZUECI_ERROR_INVALID_ARGS, { 0, ZUECI_ERROR_INVALID_ARGS } },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, ret;
+
+    unsigned char dest[1024];
+    unsigned char expected[1024];
+
+    testStart("test_utf8_to_eci_batch");
+
+    for (i = 0; i < data_size; i++) {
+        int src_lens[3];
+        int dest_offsets[4];
+        int rets[3];
+
+        if (testContinue(p_ctx, i)) continue;
+
+        for (j = 0; j < data[i].count; j++) {
+            src_lens[j] = data[i].data[j] ? (int) ustrlen(data[i].data[j]) : 0;
+        }
+
+        ret = zueci_utf8_to_eci_batch(data[i].eci, (const unsigned char *const *) data[i].data, src_lens,
+                data[i].count, dest, dest_offsets, rets);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+
+        for (j = 0; j < data[i].count; j++) {
+            const int len = dest_offsets[j + 1] - dest_offsets[j];
+            assert_equal(rets[j], data[i].expected_rets[j], "i:%d j:%d rets[j] %d != %d\n",
+                i, j, rets[j], data[i].expected_rets[j]);
+            if (rets[j] == 0) {
+                int expected_len = 0;
+                ret = zueci_utf8_to_eci(data[i].eci, data[i].data[j], src_lens[j], expected, &expected_len);
+                assert_zero(ret, "i:%d j:%d zueci_utf8_to_eci ret %d != 0\n", i, j, ret);
+                assert_equal(len, expected_len, "i:%d j:%d len %d != expected_len %d\n", i, j, len, expected_len);
+                assert_zero(memcmp(dest + dest_offsets[j], expected, len), "i:%d j:%d memcmp != 0\n", i, j);
+            } else {
+                assert_zero(len, "i:%d j:%d len %d != 0\n", i, j, len);
+            }
+        }
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_utf8_to_eci_bounded(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int dest_size;
+        int ret;
+        int expected_src_used;
+        int expected_dest_len;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, TU("AB\xC3\xA9"), 3, 0, 4, 3 },
+        /*  1*/ { 3, TU("AB\xC3\xA9"), 2, ZUECI_WARN_DEST_FULL, 2, 2 },
+        /*  2*/ { 3, TU("AB\xC3\xA9\x80"), 3, ZUECI_ERROR_INVALID_UTF8, -1, -1 },
+        /*  3*/ { 26, TU("A\xE2\x82\xAC" "B"), 3, ZUECI_WARN_DEST_FULL, 1, 1 },
+        /*  4*/ { 32, TU("A\xE9\xBE\xA6" "B"), 4, ZUECI_WARN_DEST_FULL, 1, 1 }, /* U+9FA6 -> 4-byter */
+        /*  5*/ { 32, TU("A\xE9\xBE\xA6" "B"), 5, ZUECI_WARN_DEST_FULL, 4, 5 },
+        /*  6*/ { 34, TU("AB"), 7, ZUECI_WARN_DEST_FULL, 1, 4 },
+        /*  7*/ { 34, TU("AB"), 8, 0, 2, 8 },
+        /*  8*/ { 25, TU("A\xF0\x9F\x98\x80"), 5, ZUECI_WARN_DEST_FULL, 1, 2 }, /* Surrogate pair needs 4 */
+        /*  9*/ { 25, TU("A\xF0\x9F\x98\x80"), 0, ZUECI_WARN_DEST_FULL, 0, 0 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, src_len, ret;
+
+    unsigned char dest[1024];
+    unsigned char expected[1024];
+
+    testStart("test_utf8_to_eci_bounded");
+
+    for (i = 0; i < data_size; i++) {
+        int src_used = -1, dest_len = -1, expected_len = 0;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src_len = (int) ustrlen(data[i].data);
+
+        ret = zueci_utf8_to_eci_bounded(data[i].eci, data[i].data, src_len, dest, data[i].dest_size, &src_used,
+                &dest_len);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        if (ret >= ZUECI_ERROR) {
+            continue;
+        }
+        assert_equal(src_used, data[i].expected_src_used, "i:%d src_used %d != %d\n",
+            i, src_used, data[i].expected_src_used);
+        assert_equal(dest_len, data[i].expected_dest_len, "i:%d dest_len %d != %d\n",
+            i, dest_len, data[i].expected_dest_len);
+
+        /* Continue until done (enlarging if no room for a single character) and check same as one-shot */
+        while (ret == ZUECI_WARN_DEST_FULL) {
+            const int total_src_used = src_used, total_dest_len = dest_len;
+            const int dest_size = data[i].dest_size < 4 ? 4 : data[i].dest_size;
+            ret = zueci_utf8_to_eci_bounded(data[i].eci, data[i].data + src_used, src_len - src_used,
+                    dest + dest_len, dest_size, &src_used, &dest_len);
+            assert_zero(ret >= ZUECI_ERROR, "i:%d ret %d >= ZUECI_ERROR\n", i, ret);
+            src_used += total_src_used;
+            dest_len += total_dest_len;
+        }
+        assert_equal(src_used, src_len, "i:%d src_used %d != src_len %d\n", i, src_used, src_len);
+
+        ret = zueci_utf8_to_eci(data[i].eci, data[i].data, src_len, expected, &expected_len);
+        assert_zero(ret, "i:%d zueci_utf8_to_eci ret %d != 0\n", i, ret);
+        assert_equal(dest_len, expected_len, "i:%d dest_len %d != expected_len %d\n", i, dest_len, expected_len);
+        assert_zero(memcmp(dest, expected, dest_len), "i:%d memcmp != 0\n", i);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_utf8_to_eci_mt(const testCtx *const p_ctx) {
+
+    struct item {
+        int eci;
+        unsigned char *data;
+        int repeat;
+        int threads;
+        int bad_pos; /* If non-negative, set to 0xFF */
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { 3, TU("AB\xC3\xA9"), 100000, 4, -1, 0 },
+        /*  1*/ { 3, TU("AB\xC3\xA9"), 100000, 1, -1, 0 },
+        /*  2*/ { 3, TU("AB\xC3\xA9"), 10, 4, -1, 0 },
+        /*  3*/ { 3, TU("AB\xC3\xA9"), 100000, 4, 350000, ZUECI_ERROR_INVALID_UTF8 },
+        /*  4*/ { 3, TU("A\xE2\x82\xAC"), 100000, 4, 0, ZUECI_ERROR_INVALID_UTF8 }, /* First error only */
+        /*  5*/ { 3, TU("A\xE2\x82\xAC"), 100000, 4, 350000, ZUECI_ERROR_INVALID_DATA },
+        /*  6*/ { 26, TU("\xF0\x9F\x98\x80\xE2\x82\xAC"), 50000, 8, -1, 0 },
+        /*  7*/ { 32, TU("\xE9\xBE\xA6" "A\xC2\xA8"), 50000, 3, -1, 0 },
+        /*  8*/ { 34, TU("A\xC3\xA9"), 100000, 5, -1, 0 },
+        /*  9*/ { 27, TU("ABC"), 100000, 7, 200000, ZUECI_ERROR_INVALID_UTF8 },
+        /* 10*/ { 25, TU("A\xF0\x9F\x98\x80"), 60000, 100, -1, 0 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, ret, expected_ret;
+
+    testStart("test_utf8_to_eci_mt");
+
+    for (i = 0; i < data_size; i++) {
+        unsigned char *src, *dest, *expected;
+        int src_len, dest_len = -1, expected_len = -1;
+        const int len = (int) ustrlen(data[i].data);
+
+        if (testContinue(p_ctx, i)) continue;
+
+        src_len = len * data[i].repeat;
+        src = (unsigned char *) malloc(src_len);
+        dest = (unsigned char *) malloc(src_len * 4);
+        expected = (unsigned char *) malloc(src_len * 4);
+        assert_nonnull(src, "i:%d src NULL\n", i);
+        assert_nonnull(dest, "i:%d dest NULL\n", i);
+        assert_nonnull(expected, "i:%d expected NULL\n", i);
+
+        for (j = 0; j < data[i].repeat; j++) {
+            memcpy(src + j * len, data[i].data, len);
+        }
+        if (data[i].bad_pos >= 0) {
+            src[data[i].bad_pos] = 0xFF;
+        }
+
+        ret = zueci_utf8_to_eci_mt(data[i].eci, src, src_len, dest, &dest_len, data[i].threads);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+
+        expected_ret = zueci_utf8_to_eci(data[i].eci, src, src_len, expected, &expected_len);
+        assert_equal(ret, expected_ret, "i:%d ret %d != expected_ret %d\n", i, ret, expected_ret);
+        if (ret == 0) {
+            assert_equal(dest_len, expected_len, "i:%d dest_len %d != expected_len %d\n",
+                i, dest_len, expected_len);
+            assert_zero(memcmp(dest, expected, dest_len), "i:%d memcmp != 0\n", i);
+        }
+
+        free(src);
+        free(dest);
+        free(expected);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_utf8_eci_mask(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned char *data;
+        int ret;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { TU(""), 0 },
+        /*  1*/ { TU("ABC"), 0 },
+        /*  2*/ { TU("AB\\~#"), 0 },
+        /*  3*/ { TU("A\xC2\x80"), 0 },
+        /*  4*/ { TU("\xC3\xA9"), 0 },
+        /*  5*/ { TU("\xC3\xA9\xC5\x81"), 0 },
+        /*  6*/ { TU("\xD0\x96\xE2\x82\xAC"), 0 },
+        /*  7*/ { TU("\xE2\x96\xA0"), 0 }, /* U+25A0 in IBM CP437 */
+        /*  8*/ { TU("\xE2\x96\xA1"), 0 },
+        /*  9*/ { TU("\xE9\xBE\xA6"), 0 },
+        /* 10*/ { TU("\xE4\xB8\x80\xEF\xBD\xB1" "ABC~"), 0 },
+        /* 11*/ { TU("\xF0\x9F\x98\x80" "A\xC3\xA9"), 0 },
+        /* 12*/ { TU("\xF0\x9F\x98\x80" "A\xC3"), ZUECI_ERROR_INVALID_UTF8 },
+        /* 13*/ { TU("A\x80"), ZUECI_ERROR_INVALID_UTF8 },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, length, ret;
+    zueci_u32 u;
+
+    static const int ecis[] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 170, 899
+    };
+    const unsigned long long unicode_mask = ZUECI_ECI_BIT(25) | ZUECI_ECI_BIT(26) | ZUECI_ECI_BIT(32)
+                                            | ZUECI_ECI_BIT(33) | ZUECI_ECI_BIT(34) | ZUECI_ECI_BIT(35);
+
+    unsigned char src[8];
+    unsigned char dest[64];
+
+    testStart("test_utf8_eci_mask");
+
+    for (i = 0; i < data_size; i++) {
+        unsigned long long mask = 0, expected_mask = 0;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        length = (int) ustrlen(data[i].data);
+
+        ret = zueci_utf8_eci_mask(data[i].data, length, &mask);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        if (ret) {
+            continue;
+        }
+        for (j = 0; j < ZUECI_ASIZE(ecis); j++) {
+            int dest_len;
+            if (zueci_utf8_to_eci(ecis[j], data[i].data, length, dest, &dest_len) == 0) {
+                expected_mask |= ZUECI_ECI_BIT(ecis[j]);
+            }
+        }
+        assert_equal(mask, expected_mask, "i:%d mask 0x%llX != 0x%llX\n", i, mask, expected_mask);
+        assert_equal(mask & unicode_mask, unicode_mask, "i:%d mask 0x%llX missing Unicode ECIs\n", i, mask);
+    }
+
+    /* Every codepoint (non-BMP sampled) agrees with `zueci_utf8_to_eci()` */
+    for (u = 0; u < 0x110000; u += u < 0x10000 ? 1 : 0x3FF) {
+        unsigned long long mask = 0, expected_mask = 0;
+        if (u >= 0xD800 && u < 0xE000) {
+            continue;
+        }
+        if (u < 0x80) {
+            src[0] = (unsigned char) u;
+            length = 1;
+        } else if (u < 0x800) {
+            src[0] = (unsigned char) (0xC0 | (u >> 6));
+            src[1] = (unsigned char) (0x80 | (u & 0x3F));
+            length = 2;
+        } else if (u < 0x10000) {
+            src[0] = (unsigned char) (0xE0 | (u >> 12));
+            src[1] = (unsigned char) (0x80 | ((u >> 6) & 0x3F));
+            src[2] = (unsigned char) (0x80 | (u & 0x3F));
+            length = 3;
+        } else {
+            src[0] = (unsigned char) (0xF0 | (u >> 18));
+            src[1] = (unsigned char) (0x80 | ((u >> 12) & 0x3F));
+            src[2] = (unsigned char) (0x80 | ((u >> 6) & 0x3F));
+            src[3] = (unsigned char) (0x80 | (u & 0x3F));
+            length = 4;
+        }
+        ret = zueci_utf8_eci_mask(src, length, &mask);
+        assert_zero(ret, "u:0x%04X ret %d != 0\n", u, ret);
+        for (j = 0; j < ZUECI_ASIZE(ecis); j++) {
+            int dest_len;
+            if (zueci_utf8_to_eci(ecis[j], src, length, dest, &dest_len) == 0) {
+                expected_mask |= ZUECI_ECI_BIT(ecis[j]);
+            }
+        }
+        assert_equal(mask, expected_mask, "u:0x%04X mask 0x%llX != 0x%llX\n", u, mask, expected_mask);
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+static void test_best_eci(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned char *data;
+        int ecis[8];
+        int ecis_len;
+        int ret;
+        int expected_eci;
+        int expected_dest_len;
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { TU("ABC"), { 26, 25, 3 }, 3, 0, 26, 3 }, /* Earliest wins ties */
+        /*  1*/ { TU("ABC"), { 25, 34 }, 2, 0, 25, 6 },
+        /*  2*/ { TU("AB\xC3\xA9"), { 26, 3, 25 }, 3, 0, 3, 3 },
+        /*  3*/ { TU("\xE4\xB8\x80\xE4\xBA\x8C"), { 26, 25, 32, 29 }, 4, 0, 25, 4 }, /* Ties UTF-16BE, GB 18030 & GB 2312 */
+        /*  4*/ { TU("\xE4\xB8\x80\xE4\xBA\x8C"), { 29, 31, 32, 26, 25 }, 5, 0, 29, 4 },
+        /*  5*/ { TU("\xE4\xB8\x80" "AB"), { 26, 33, 32 }, 3, 0, 32, 4 },
+        /*  6*/ { TU("\xE4\xB8\x80" "AB"), { 3, 27 }, 2, ZUECI_ERROR_INVALID_DATA, -1, -1 },
+        /*  7*/ { TU("\xE9\xBE\xA6"), { 29, 32, 26 }, 3, 0, 26, 3 }, /* U+9FA6 GB 18030 4-byter */
+        /*  8*/ { TU("\xF0\x9F\x98\x80"), { 26, 33, 34 }, 3, 0, 26, 4 },
+        /*  9*/ { TU("AB#"), { 170, 27 }, 2, 0, 27, 3 }, /* Invariant can't do '#' */
+        /* 10*/ { TU("AB"), { 170, 27 }, 2, 0, 170, 2 },
+        /* 11*/ { TU("A\xC3"), { 3, 26 }, 2, ZUECI_ERROR_INVALID_UTF8, -1, -1 },
+        /* 12*/ { TU("A\xC3"), { 27 }, 1, ZUECI_ERROR_INVALID_UTF8, -1, -1 },
+        /* 13*/ { TU("A"), { 3, 14 }, 2, ZUECI_ERROR_INVALID_ECI, -1, -1 },
+        /* 14*/ { TU("A"), { 3 }, 0, ZUECI_ERROR_INVALID_ARGS, -1, -1 },
+        /* 15*/ { TU(""), { 34, 3 }, 2, 0, 34, 0 },
+        /* 16*/ { TU("\xE3\x83\xBB"), { 32, 31, 29 }, 3, 0, 29, 2 }, /* U+30FB in GB 2312 but not GBK */
+        /* 17*/ { TU("\xE3\x83\xBB"), { 31, 32 }, 2, 0, 32, 4 },
+        /* 18*/ { TU("\xE2\x80\x95"), { 32, 31, 29 }, 3, 0, 32, 2 }, /* U+2015 GB 2312 0xA1AA, GBK 0xA844 */
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, length, ret;
+
+    unsigned char dest[1024];
+
+    testStart("test_best_eci");
+
+    for (i = 0; i < data_size; i++) {
+        int eci = -1, dest_len = -1;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        length = (int) ustrlen(data[i].data);
+
+        ret = zueci_best_eci(data[i].data, length, data[i].ecis, data[i].ecis_len, &eci, &dest_len);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        assert_equal(eci, data[i].expected_eci, "i:%d eci %d != %d\n", i, eci, data[i].expected_eci);
+        assert_equal(dest_len, data[i].expected_dest_len, "i:%d dest_len %d != %d\n",
+            i, dest_len, data[i].expected_dest_len);
+        if (ret) {
+            continue;
+        }
+
+        /* Check against converting with each */
+        for (j = 0; j < data[i].ecis_len; j++) {
+            int len = -1;
+            if (zueci_utf8_to_eci(data[i].ecis[j], data[i].data, length, dest, &len) == 0) {
+                assert_nonzero(len >= dest_len, "i:%d j:%d len %d < dest_len %d\n", i, j, len, dest_len);
+                if (data[i].ecis[j] == eci) {
+                    assert_equal(len, dest_len, "i:%d j:%d len %d != dest_len %d\n", i, j, len, dest_len);
+                }
+            }
+        }
+    }
+
+    testFinish();
+}
+
+static void test_utf8_segment(const testCtx *const p_ctx) {
+
+    struct item {
+        unsigned char *data;
+        int ecis[8];
+        int ecis_len;
+        int switch_cost;
+        int ret;
+        int expected_segs_len;
+        int expected_total_len;
+        zueci_segment expected_segs[4];
+    };
+    /* s/\/\*[ 0-9]*\*\//\=printf("\/\*%3d*\/", line(".") - line("'<")): */
+    static const struct item data[] = {
+        /*  0*/ { TU("ABC"), { 3, 26 }, 2, 2, 0, 1, 5, { { 3, 0, 3, 3 } } },
+        /*  1*/ { TU("ABC\xE4\xB8\x80\xE4\xBA\x8C"), { 3, 29 }, 2, 2, 0, 1, 9, { { 29, 0, 9, 7 } } },
+        /*  2*/ { TU("ABC\xF0\x9F\x98\x80\xE4\xB8\x80\xE4\xBA\x8C"), { 3, 29, 26 }, 3, 2, 0, 1, 15, { { 26, 0, 13, 13 } } }, /* Tie, fewer segments */
+        /*  3*/ { TU("ABC\xF0\x9F\x98\x80\xE4\xB8\x80\xE4\xBA\x8C\xE4\xB8\x89\xE5\x9B\x9B"), { 3, 29, 26 }, 3, 2, 0, 2, 19, { { 26, 0, 7, 7 }, { 29, 7, 12, 8 } } },
+        /*  4*/ { TU("\xC3\x84\xC3\x84\xE4\xB8\x80\xE4\xBA\x8C\xE4\xB8\x89\xC3\x84\xC3\x84"), { 3, 29, 26 }, 3, 2, 0, 3, 16, { { 3, 0, 4, 2 }, { 29, 4, 9, 6 }, { 3, 13, 4, 2 } } },
+        /*  5*/ { TU("\xC3\x84\xC3\x84\xE4\xB8\x80\xE4\xBA\x8C\xE4\xB8\x89\xC3\x84\xC3\x84"), { 3, 29, 26 }, 3, 5, 0, 1, 22, { { 26, 0, 17, 17 } } },
+        /*  6*/ { TU("AB#"), { 170, 25 }, 2, 0, 0, 2, 4, { { 170, 0, 2, 2 }, { 25, 2, 1, 2 } } },
+        /*  7*/ { TU("AB"), { 26, 3 }, 2, 1, 0, 1, 3, { { 26, 0, 2, 2 } } }, /* Earliest wins ties */
+        /*  8*/ { TU("\xE4\xB8\x80"), { 29, 29, 3 }, 3, 2, 0, 1, 4, { { 29, 0, 3, 2 } } },
+        /*  9*/ { TU(""), { 3 }, 1, 2, 0, 0, 0, { { 0 } } },
+        /* 10*/ { TU("A\xF0\x9F\x98\x80"), { 3, 29 }, 2, 2, ZUECI_ERROR_INVALID_DATA, -1, -1, { { 0 } } },
+        /* 11*/ { TU("A\xC3"), { 3, 26 }, 2, 2, ZUECI_ERROR_INVALID_UTF8, -1, -1, { { 0 } } },
+        /* 12*/ { TU("A"), { 3, 14 }, 2, 2, ZUECI_ERROR_INVALID_ECI, -1, -1, { { 0 } } },
+        /* 13*/ { TU("A"), { 3 }, 0, 2, ZUECI_ERROR_INVALID_ARGS, -1, -1, { { 0 } } },
+        /* 14*/ { TU("A"), { 3 }, 1, -1, ZUECI_ERROR_INVALID_ARGS, -1, -1, { { 0 } } },
+    };
+    const int data_size = ZUECI_ASIZE(data);
+    int i, j, length, ret;
+
+    zueci_segment segs[64];
+    unsigned char dest[1024];
+
+    testStart("test_utf8_segment");
+
+    for (i = 0; i < data_size; i++) {
+        int segs_len = -1, total_len = -1, sum, best_eci, best_len;
+
+        if (testContinue(p_ctx, i)) continue;
+
+        length = (int) ustrlen(data[i].data);
+        assert_nonzero(length <= ZUECI_ASIZE(segs), "i:%d length %d > segs size\n", i, length);
+
+        ret = zueci_utf8_segment(data[i].data, length, data[i].ecis, data[i].ecis_len, data[i].switch_cost, segs,
+                &segs_len, &total_len);
+        assert_equal(ret, data[i].ret, "i:%d ret %d != %d\n", i, ret, data[i].ret);
+        if (ret) {
+            continue;
+        }
+        assert_equal(segs_len, data[i].expected_segs_len, "i:%d segs_len %d != %d\n",
+            i, segs_len, data[i].expected_segs_len);
+        assert_equal(total_len, data[i].expected_total_len, "i:%d total_len %d != %d\n",
+            i, total_len, data[i].expected_total_len);
+
+        sum = 0;
+        for (j = 0; j < segs_len; j++) {
+            const zueci_segment *const seg = segs + j;
+            const zueci_segment *const expected = data[i].expected_segs + j;
+            int len = -1;
+            assert_equal(seg->eci, expected->eci, "i:%d j:%d eci %d != %d\n", i, j, seg->eci, expected->eci);
+            assert_equal(seg->offset, expected->offset, "i:%d j:%d offset %d != %d\n",
+                i, j, seg->offset, expected->offset);
+            assert_equal(seg->length, expected->length, "i:%d j:%d length %d != %d\n",
+                i, j, seg->length, expected->length);
+            assert_equal(seg->dest_len, expected->dest_len, "i:%d j:%d dest_len %d != %d\n",
+                i, j, seg->dest_len, expected->dest_len);
+
+            /* Check against converting the segment */
+            ret = zueci_utf8_to_eci(seg->eci, data[i].data + seg->offset, seg->length, dest, &len);
+            assert_zero(ret, "i:%d j:%d zueci_utf8_to_eci ret %d != 0\n", i, j, ret);
+            assert_equal(len, seg->dest_len, "i:%d j:%d len %d != dest_len %d\n", i, j, len, seg->dest_len);
+            sum += len + data[i].switch_cost;
+        }
+        assert_equal(sum, total_len, "i:%d sum %d != total_len %d\n", i, sum, total_len);
+
+        /* Never worse than a single segment */
+        if (length && zueci_best_eci(data[i].data, length, data[i].ecis, data[i].ecis_len, &best_eci, &best_len)
+                == 0) {
+            assert_nonzero(total_len <= best_len + data[i].switch_cost, "i:%d total_len %d > %d\n",
+                i, total_len, best_len + data[i].switch_cost);
+        }
+    }
+
+    testFinish();
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
 int main(int argc, char *argv[]) {
 
     testFunction funcs[] = { /* name, func */
@@ -1485,6 +2516,21 @@ int main(int argc, char *argv[]) {
 #endif
 #ifndef ZUECI_EMBED_NO_TO_UTF8
         { "test_replacement_char_flags", test_replacement_char_flags },
+        { "test_utf8_valid", test_utf8_valid },
+        { "test_stream", test_stream },
+        { "test_eci_to_utf8_bounded", test_eci_to_utf8_bounded },
+        { "test_eci_to_utf8_alloc", test_eci_to_utf8_alloc },
+        { "test_eci_to_utf8_batch", test_eci_to_utf8_batch },
+        { "test_eci_to_utf8_mt", test_eci_to_utf8_mt },
+        { "test_eci_to_utf8_mt_split", test_eci_to_utf8_mt_split },
+#endif
+#ifndef ZUECI_EMBED_NO_TO_ECI
+        { "test_utf8_to_eci_bounded", test_utf8_to_eci_bounded },
+        { "test_utf8_to_eci_batch", test_utf8_to_eci_batch },
+        { "test_utf8_to_eci_mt", test_utf8_to_eci_mt },
+        { "test_utf8_eci_mask", test_utf8_eci_mask },
+        { "test_best_eci", test_best_eci },
+        { "test_utf8_segment", test_utf8_segment },
 #endif
     };
 
@@ -15,6 +15,7 @@
 #include "../zueci_common.h"
 
 #include <assert.h>
+#include <time.h>
 
 static int tests = 0;
 static int failed = 0;
@@ -361,4 +362,92 @@ zueci_u32 testConvertUtf8ToUnicode(const unsigned char *src, const int src_len)
     return state == 0 ? u : 0;
 }
 
+/* Binary search of `u` in sorted `tab_u` of size `size`, returning index or -1 (the kind of sorted-table lookup
+   the page tables replaced) */
+static int test_perf_bsearch(const zueci_u32 *tab_u, const int size, const zueci_u32 u) {
+    int s = 0;
+    int e = size - 1;
+    while (s <= e) {
+        const int m = (s + e) >> 1;
+        if (tab_u[m] < u) {
+            s = m + 1;
+        } else if (tab_u[m] > u) {
+            e = m - 1;
+        } else {
+            return m;
+        }
+    }
+    return -1;
+}
+
+/* Helper to time Unicode to ECI routine `u_eci_func` over the codepoints below `end` (UTF-16 surrogates excepted),
+   i.e. the `test_u_gamut()` range, `repeat` times, against a binary search of a sorted table of the same mappings,
+   printing the timings. Returns 1 if both give the same output, 0 if not (or if out of memory) */
+int testPerfUGamut(const char *name, const testUEciFunc_t u_eci_func, const zueci_u32 end, const int repeat) {
+    zueci_u32 *tab_u = (zueci_u32 *) malloc(sizeof(zueci_u32) * end);
+    zueci_u32 *tab_mb = (zueci_u32 *) malloc(sizeof(zueci_u32) * end);
+    unsigned char *tab_len = (unsigned char *) malloc(end);
+    unsigned char dest[4];
+    unsigned int sum_func = 0, sum_bsearch = 0;
+    clock_t start;
+    clock_t diff_func, diff_bsearch;
+    int size = 0;
+    int i, j, ret;
+    zueci_u32 u;
+
+    if (!tab_u || !tab_mb || !tab_len) {
+        free(tab_u);
+        free(tab_mb);
+        free(tab_len);
+        return 0;
+    }
+
+    /* Sorted table of the mappings, with the multibytes packed big-endian */
+    for (u = 0; u < end; u = u == 0xD7FF ? 0xE000 : u + 1) {
+        if ((ret = u_eci_func(u, dest))) {
+            tab_u[size] = u;
+            for (j = 0, tab_mb[size] = 0; j < ret; j++) {
+                tab_mb[size] = (tab_mb[size] << 8) | dest[j];
+            }
+            tab_len[size++] = (unsigned char) ret;
+        }
+    }
+
+    start = clock();
+    for (i = 0; i < repeat; i++) {
+        for (u = 0; u < end; u = u == 0xD7FF ? 0xE000 : u + 1) {
+            if ((ret = u_eci_func(u, dest))) {
+                sum_func = sum_func * 31 + ret + dest[0] + dest[ret - 1];
+            }
+        }
+    }
+    diff_func = clock() - start;
+
+    start = clock();
+    for (i = 0; i < repeat; i++) {
+        for (u = 0; u < end; u = u == 0xD7FF ? 0xE000 : u + 1) {
+            const int idx = test_perf_bsearch(tab_u, size, u);
+            if (idx != -1) {
+                zueci_u32 mb = tab_mb[idx];
+                ret = tab_len[idx];
+                for (j = ret - 1; j >= 0; j--, mb >>= 8) {
+                    dest[j] = (unsigned char) mb;
+                }
+                sum_bsearch = sum_bsearch * 31 + ret + dest[0] + dest[ret - 1];
+            }
+        }
+    }
+    diff_bsearch = clock() - start;
+
+    printf("%s (%d mappings, %d lookups): %.2fms, bsearch %.2fms\n", name, size,
+            (int) (end - (end > 0xE000 ? 0x800 : 0)) * repeat, diff_func * 1000.0 / CLOCKS_PER_SEC,
+            diff_bsearch * 1000.0 / CLOCKS_PER_SEC);
+
+    free(tab_u);
+    free(tab_mb);
+    free(tab_len);
+
+    return sum_func == sum_bsearch;
+}
+
 /* vim: set ts=4 sw=4 et : */
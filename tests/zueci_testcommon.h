@@ -14,6 +14,7 @@
 #define ZUECI_TESTCOMMON_H
 
 #define ZUECI_DEBUG_TEST_PRINT           16
+#define ZUECI_DEBUG_TEST_PERFORMANCE     256
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -95,6 +96,12 @@ int testConvertUnicodeToUtf8(const zueci_u32 u, unsigned char *buf);
 /* Helper to convert a single UTF-8 sequence to a Unicode codepoint */
 zueci_u32 testConvertUtf8ToUnicode(const unsigned char *src, const int src_len);
 
+/* Unicode to ECI routine, as wrapped by the `zueci_u_XXX_test()` functions */
+typedef int (*testUEciFunc_t)(const zueci_u32 u, unsigned char *dest);
+
+/* Helper to time `u_eci_func` over the `test_u_gamut()` range against a binary search of the same mappings */
+int testPerfUGamut(const char *name, const testUEciFunc_t u_eci_func, const zueci_u32 end, const int repeat);
+
 #ifdef __cplusplus
 }
 #endif
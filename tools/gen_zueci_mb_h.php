@@ -77,17 +77,185 @@ function out_tab_entries(&$out, $arr, $cnt, $not_hex = false) {
     }
 }
 
-/* Output tables to `$out` array */
-function out_tabs(&$out, $name, $u_u, $u_mb, $mb_u, $no_u_ind = false, $u_u_comment = '', $u_mb_comment = '', $mb_u_comment = '') {
-    if ($u_u_comment == '') $u_u_comment = 'Unicode codepoints sorted';
-    $cnt_u_u = count($u_u);
+/* Output two-level page table for non-URO Unicode `$u_u` to multibyte `$u_mb`: a 256-entry directory by `u >> 8` of
+   pages, each of 16 indexes by `(u >> 4) & 0xF` of shared blocks of 16 multibyte values by `u & 0xF` */
+function out_pg_tabs(&$out, $name, $u_u, $u_mb) {
+    $u_mb_search = array_combine($u_u, $u_mb);
+    $blocks = array(implode(',', array_fill(0, 16, 0)) => 0); // Block 0 empty
+    $pages = array(implode(',', array_fill(0, 16, 0)) => 0); // Page 0 empty
+    $pg_dir = array();
+    $pg = $pg_mb = array_fill(0, 16, 0);
+    for ($hi = 0; $hi < 0x100; $hi++) {
+        $page = array();
+        for ($mid = 0; $mid < 0x10; $mid++) {
+            $block = array();
+            for ($lo = 0; $lo < 0x10; $lo++) {
+                $u = ($hi << 8) | ($mid << 4) | $lo;
+                $block[] = isset($u_mb_search[$u]) ? $u_mb_search[$u] : 0;
+            }
+            $key = implode(',', $block);
+            if (!isset($blocks[$key])) {
+                $blocks[$key] = count($blocks);
+                $pg_mb = array_merge($pg_mb, $block);
+            }
+            $page[] = $blocks[$key];
+        }
+        $key = implode(',', $page);
+        if (!isset($pages[$key])) {
+            $pages[$key] = count($pages);
+            $pg = array_merge($pg, $page);
+        }
+        $pg_dir[] = $pages[$key];
+    }
+    assert(count($blocks) <= 256 && count($pages) <= 256);
+
     $out[] = '';
     $out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
-    $out[] = '/* ' . $u_u_comment . ' */';
-    $out[] = 'static const zueci_u16 zueci_' . $name . '_u_u[' . $cnt_u_u . '] = {';
-    out_tab_entries($out, $u_u, $cnt_u_u);
+    $out[] = '/* Non-URO page directory indexed by `u >> 8` of pages in `zueci_' . $name . '_pg[]` (page 0 empty) */';
+    $out[] = 'static const unsigned char zueci_' . $name . '_pg_dir[256] = {';
+    out_tab_entries($out, $pg_dir, 256, true /*not_hex*/);
+    $out[] = '};';
+    $out[] = '';
+    $out[] = '/* Non-URO pages of 16 indexes by `(u >> 4) & 0xF` of blocks in `zueci_' . $name . '_pg_mb[]` (block 0 empty) */';
+    $out[] = 'static const unsigned char zueci_' . $name . '_pg[' . count($pg) . '] = {';
+    out_tab_entries($out, $pg, count($pg), true /*not_hex*/);
+    $out[] = '};';
+    $out[] = '';
+    $out[] = '/* Non-URO blocks of 16 multibyte values by `u & 0xF`, 0 if none */';
+    $out[] = 'static const zueci_u16 zueci_' . $name . '_pg_mb[' . count($pg_mb) . '] = {';
+    out_tab_entries($out, $pg_mb, count($pg_mb));
     $out[] = '};';
     $out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
+}
+
+/* Index of 2-byte multibyte `$mb` in the dense GBK/GB 18030 tables, `(lead - 0x81) * 191 + trail - 0x40` */
+function mb2_ind($mb) {
+    return (($mb >> 8) - 0x81) * 191 + ($mb & 0xFF) - 0x40;
+}
+
+/* Output dense 2-byte table `$arr` named `zueci_<name>_mb2_u` */
+function out_mb2_tab(&$out, $name, $arr, $comment) {
+    $cnt = count($arr);
+    $out[] = '';
+    $out[] = '#ifndef ZUECI_EMBED_NO_TO_UTF8';
+    $out[] = '/* ' . $comment . ' */';
+    $out[] = 'static const zueci_u16 zueci_' . $name . '_mb2_u[' . $cnt . '] = {';
+    out_tab_entries($out, $arr, $cnt);
+    $out[] = '};';
+    $out[] = '#endif /* ZUECI_EMBED_NO_TO_UTF8 */';
+}
+
+/* Lower bound of `$key` in sorted array `$arr` */
+function lower_bound($arr, $key) {
+    $s = 0;
+    $e = count($arr) - 1;
+    while ($s < $e) {
+        $m = ($s + $e) >> 1;
+        if ($arr[$m] < $key) {
+            $s = $m + 1;
+        } else {
+            $e = $m;
+        }
+    }
+    return $s;
+}
+
+/* Linear offset of GB 18030 4-byter `$mb4` */
+function gb18030_mb4_lin($mb4) {
+    $c1 = ($mb4 >> 24) & 0xFF;
+    $c2 = ($mb4 >> 16) & 0xFF;
+    $c3 = ($mb4 >> 8) & 0xFF;
+    $c4 = $mb4 & 0xFF;
+    return ((($c1 - 0x81) * 10 + ($c2 - 0x30)) * 126 + ($c3 - 0x81)) * 10 + $c4 - 0x30;
+}
+
+/* Two-level bucket index of `$keys` (key => index of block) into sorted block ends `$ends` such that at most one
+   correction step is needed - level 1 by `key >> 7`, level 2 (pages of 64) by `(key >> 1) & 0x3F` */
+function bucket_ind($ends, $keys, $max_key, &$ind1, &$ind2) {
+    $pages = array();
+    foreach ($keys as $key => $s) {
+        if ($s - lower_bound($ends, ($key >> 7) << 7) > 1) {
+            $pages[$key >> 7] = true;
+        }
+    }
+    $ind1 = array();
+    $ind2 = array();
+    for ($page = 0, $cnt = ($max_key >> 7) + 1; $page < $cnt; $page++) {
+        if (isset($pages[$page])) {
+            $ind1[] = 0x100 + intdiv(count($ind2), 64);
+            for ($i = 0; $i < 64; $i++) {
+                $ind2[] = lower_bound($ends, ($page << 7) + ($i << 1));
+            }
+        } else {
+            $ind1[] = lower_bound($ends, $page << 7);
+        }
+    }
+}
+
+/* Perfect hash bucket (of 128) of 16-bit `$key` - must match `ZUECI_GB18030_PHASH()` */
+function phash_bucket($key) {
+    return (($key * 0x9E3779B1) & 0xFFFFFFFF) >> 25;
+}
+
+/* Perfect hash slot (of `$n`) of 16-bit `$key` given its bucket displacement `$d` - must match
+   `ZUECI_GB18030_PHASH()` */
+function phash_slot($key, $d, $n) {
+    return (((((($key ^ $d) * 0x85EBCA6B) & 0xFFFFFFFF) >> 16) * $n) >> 16);
+}
+
+/* Minimal perfect hash (hash and displace) of distinct 16-bit `$keys`, setting bucket displacements `$d` and
+   returning the indexes of `$keys` in slot order */
+function phash($keys, &$d) {
+    $n = count($keys);
+    $buckets = array_fill(0, 128, array());
+    foreach ($keys as $i => $key) {
+        $buckets[phash_bucket($key)][] = $i;
+    }
+    // Place largest buckets first
+    $order = range(0, 127);
+    usort($order, function ($a, $b) use ($buckets) {
+        $diff = count($buckets[$b]) - count($buckets[$a]);
+        return $diff ? $diff : $a - $b;
+    });
+    $d = array_fill(0, 128, 0);
+    $slots = array_fill(0, $n, -1);
+    foreach ($order as $b) {
+        if (empty($buckets[$b])) {
+            continue;
+        }
+        for ($disp = 0; $disp < 0x10000; $disp++) {
+            $try = array();
+            foreach ($buckets[$b] as $i) {
+                $slot = phash_slot($keys[$i], $disp, $n);
+                if ($slots[$slot] !== -1 || isset($try[$slot])) {
+                    continue 2;
+                }
+                $try[$slot] = $i;
+            }
+            break;
+        }
+        assert($disp < 0x10000);
+        foreach ($try as $slot => $i) {
+            $slots[$slot] = $i;
+        }
+        $d[$b] = $disp;
+    }
+    return $slots;
+}
+
+/* Output tables to `$out` array */
+function out_tabs(&$out, $name, $u_u, $u_mb, $mb_u, $no_u_ind = false, $u_u_comment = '', $u_mb_comment = '', $mb_u_comment = '') {
+    if ($u_u_comment == '') $u_u_comment = 'Unicode codepoints sorted';
+    $cnt_u_u = count($u_u);
+    if ($cnt_u_u) {
+        $out[] = '';
+        $out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
+        $out[] = '/* ' . $u_u_comment . ' */';
+        $out[] = 'static const zueci_u16 zueci_' . $name . '_u_u[' . $cnt_u_u . '] = {';
+        out_tab_entries($out, $u_u, $cnt_u_u);
+        $out[] = '};';
+        $out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
+    }
 
     if (!empty($u_mb)) {
         if ($u_mb_comment == '') $u_mb_comment = 'Multibyte values sorted in Unicode order';
@@ -143,20 +311,68 @@ function out_tabs(&$out, $name, $u_u, $u_mb, $mb_u, $no_u_ind = false, $u_u_comm
     }
 }
 
-/* Helper to output special-case URO (Unified Repertoire and Ordering) block (U+4E00-U+9FFF) tables */
-function out_uro_tabs(&$out, $name, $tab_uro_u, $tab_uro_mb_ind) {
-    $cnt = count($tab_uro_u);
+/* Helper to output EUC-KR Hangul syllables (U+AC00-U+D7A3) rank/select index from `$hangul_u` of multibyte values
+   keyed by codepoint, checking they map in order to consecutive multibyte values starting at 0xB0A1 */
+function out_hangul_tabs(&$out, $hangul_u) {
+    ksort($hangul_u);
+    $ind = 0;
+    foreach ($hangul_u as $u => $mb) {
+        assert($mb === (((0xB0 + intdiv($ind, 94)) << 8) | (0xA1 + $ind % 94)));
+        $ind++;
+    }
     $out[] = '';
     $out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
-    $out[] = '/* Unicode usage bit-flags for URO (U+4E00-U+9FFF) block */';
-    $out[] = 'static const zueci_u16 zueci_' . $name . '_uro_u[' . $cnt . '] = {';
-    out_tab_entries($out, $tab_uro_u, $cnt);
-    $cnt = count($tab_uro_mb_ind);
+    $out[] = '/* Hangul syllables (U+AC00-U+D7A3) block rank/select index of pairs of 64-bit usage bit-flags and index of';
+    $out[] = '   first syllable used (the syllables are in the same order in Unicode and multibyte) */';
+    $out[] = 'static const unsigned long long zueci_ksx1001_hangul_rs[' . (((0xD7AF - 0xAC00 + 1) >> 6) << 1) . '] = {';
+    $line = '   ';
+    $rank = 0;
+    for ($u = 0xAC00, $i = 0; $u <= 0xD7AF; $u += 64, $i++) {
+        $words = array(0, 0, 0, 0);
+        $cnt = 0;
+        for ($j = 0; $j < 64; $j++) {
+            if (isset($hangul_u[$u + $j])) {
+                $words[$j >> 4] |= 1 << ($j & 0xF);
+                $cnt++;
+            }
+        }
+        if ($i && $i % 3 === 0) {
+            $out[] = $line;
+            $line = '   ';
+        }
+        $line .= sprintf(' 0x%08X%08XULL, %5d,', ($words[3] << 16) | $words[2], ($words[1] << 16) | $words[0], $rank);
+        $rank += $cnt;
+    }
+    if ($line !== '   ') {
+        $out[] = $line;
+    }
     $out[] = '};';
+    $out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
+}
+
+/* Helper to output special-case URO (Unified Repertoire and Ordering) block (U+4E00-U+9FFF) tables, combining the
+   16-bit usage bit-flags `$tab_uro_u` and their multibyte indexes `$tab_uro_mb_ind` into a rank/select index of
+   interleaved 64-bit bit-flags and multibyte index of first */
+function out_uro_tabs(&$out, $name, $tab_uro_u, $tab_uro_mb_ind) {
+    $cnt = count($tab_uro_u);
     $out[] = '';
-    $out[] = '/* Multibyte indexes for URO (U+4E00-U+9FFF) block */';
-    $out[] = 'static const zueci_u16 zueci_' . $name . '_uro_mb_ind[' . $cnt . '] = {';
-    out_tab_entries($out, $tab_uro_mb_ind, $cnt, true /*not_hex*/);
+    $out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
+    $out[] = '/* URO (U+4E00-U+9FFF) block rank/select index of pairs of 64-bit usage bit-flags and multibyte index of first';
+    $out[] = '   codepoint used, interleaved to share a cache line */';
+    $out[] = 'static const unsigned long long zueci_' . $name . '_uro_rs[' . ((($cnt + 3) >> 2) << 1) . '] = {';
+    $line = '   ';
+    for ($i = 0; $i < $cnt; $i += 4) {
+        if ($i && $i % 12 === 0) {
+            $out[] = $line;
+            $line = '   ';
+        }
+        $hi = ($i + 3 < $cnt ? $tab_uro_u[$i + 3] << 16 : 0) | ($i + 2 < $cnt ? $tab_uro_u[$i + 2] : 0);
+        $lo = ($i + 1 < $cnt ? $tab_uro_u[$i + 1] << 16 : 0) | $tab_uro_u[$i];
+        $line .= sprintf(' 0x%08X%08XULL, %5d,', $hi, $lo, $tab_uro_mb_ind[$i]);
+    }
+    if ($line !== '   ') {
+        $out[] = $line;
+    }
     $out[] = '};';
     $out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
 }
@@ -218,7 +434,7 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
         }
     }
     $big5_uro_u[] = $used;
-    $big5_uro_mb_ind[] = $u_i;
+    $big5_uro_mb_ind[] = $u_i - $start_u_i; // Into URO-only `zueci_big5_u_mb[]`
     $u_i = $next_u_i;
 }
 
@@ -249,9 +465,14 @@ for ($i = 0xA1; $i < 0xFA; $i++) {
 	}
 }
 
-// Output Big5 tables
+// Split multibyte table into URO and non-URO
+$uro_mb = array_slice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
 
-out_tabs($out, 'big5', $u_u, $u_mb, $mb_u, true /*no_ind*/);
+// Output Big5 tables
+out_tabs($out, 'big5', array(), $uro_mb, array(), true /*no_u_ind*/, '', 'URO multibyte values sorted in Unicode order');
+out_pg_tabs($out, 'big5', $u_u, $u_mb);
+out_tabs($out, 'big5', array(), array(), $mb_u, true /*no_u_ind*/);
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_BIG5_H */';
@@ -327,7 +548,7 @@ for ($u = 0x4E00; $u <= 0x9F9F; $u += 16) {
         }
     }
     $ksx1001_uro_u[] = $used;
-    $ksx1001_uro_mb_ind[] = $u_i;
+    $ksx1001_uro_mb_ind[] = $u_i - $start_u_i; // Into URO-only `zueci_ksx1001_u_mb[]`
     $u_i = $next_u_i;
 }
 
@@ -360,8 +581,25 @@ for ($i = 0xA1; $i < 0xFE; $i++) {
 	}
 }
 
+// Split multibyte table into URO and non-URO
+$uro_mb = array_slice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+
+// Remove Hangul syllables from non-URO tables, dealt with by their own rank/select index
+$hangul_u = array();
+for ($i = count($u_u) - 1; $i >= 0; $i--) {
+    if ($u_u[$i] >= 0xAC00 && $u_u[$i] <= 0xD7A3) {
+        $hangul_u[$u_u[$i]] = $u_mb[$i];
+        array_splice($u_u, $i, 1);
+        array_splice($u_mb, $i, 1);
+    }
+}
+
 // Output KS X 1001 tables
-out_tabs($out, 'ksx1001', $u_u, $u_mb, $mb_u);
+out_hangul_tabs($out, $hangul_u);
+out_tabs($out, 'ksx1001', array(), $uro_mb, array(), true /*no_u_ind*/, '', 'URO multibyte values sorted in Unicode order');
+out_pg_tabs($out, 'ksx1001', $u_u, $u_mb);
+out_tabs($out, 'ksx1001', array(), array(), $mb_u, true /*no_u_ind*/);
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_KSX1001_H */';
@@ -434,7 +672,7 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
         }
     }
     $sjis_uro_u[] = $used;
-    $sjis_uro_mb_ind[] = $u_i;
+    $sjis_uro_mb_ind[] = $u_i - $start_u_i; // Into URO-only `zueci_sjis_u_mb[]`
     $u_i = $next_u_i;
 }
 
@@ -468,8 +706,14 @@ for ($i = 0x81; $i < 0xEB; $i++) {
 	}
 }
 
+// Split multibyte table into URO and non-URO
+$uro_mb = array_slice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+
 // Output Shift JIS tables
-out_tabs($out, 'sjis', $u_u, $u_mb, $mb_u, true /*no_ind*/);
+out_tabs($out, 'sjis', array(), $uro_mb, array(), true /*no_u_ind*/, '', 'URO multibyte values sorted in Unicode order');
+out_pg_tabs($out, 'sjis', $u_u, $u_mb);
+out_tabs($out, 'sjis', array(), array(), $mb_u, true /*no_u_ind*/);
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_SJIS_H */';
@@ -500,6 +744,7 @@ $lines = explode("\n", $get);
 $us = array();
 $mbs = array();
 $in_gb2312 = array();
+$gb2312_mbs_u = array(); // For the dense GBK table
 foreach ($lines as $line) {
     $line = trim($line);
     if ($line === '' || strncmp($line, '0x', 2) !== 0 || strpos($line, "*** NO MAPPING ***") !== false) {
@@ -515,6 +760,7 @@ foreach ($lines as $line) {
         $us[] = $u;
         $mbs[] = $d + 0x8080; // Convert to EUC-CN
         $in_gb2312[$u] = true;
+        $gb2312_mbs_u[$d + 0x8080] = $u;
     }
 }
 
@@ -539,7 +785,7 @@ for ($u = 0x4E00; $u <= 0x9CEF; $u += 16) {
         }
     }
     $gb2312_uro_u[] = $used;
-    $gb2312_uro_mb_ind[] = $u_i;
+    $gb2312_uro_mb_ind[] = $u_i - $start_u_i; // Into URO-only `zueci_gb2312_u_mb[]`
     $u_i = $next_u_i;
 }
 
@@ -570,8 +816,14 @@ for ($i = 0xA1; $i < 0xF8; $i++) {
 	}
 }
 
+// Split multibyte table into URO and non-URO
+$uro_mb = array_slice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+
 // Output GB 2312 tables
-out_tabs($out, 'gb2312', $u_u, $u_mb, $mb_u);
+out_tabs($out, 'gb2312', array(), $uro_mb, array(), true /*no_u_ind*/, '', 'URO multibyte values sorted in Unicode order');
+out_pg_tabs($out, 'gb2312', $u_u, $u_mb);
+out_tabs($out, 'gb2312', array(), array(), $mb_u, true /*no_u_ind*/);
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_GB2312_H */';
@@ -623,6 +875,19 @@ foreach ($lines as $line) {
     }
 }
 
+// Dense multibyte table, GB 2312 first (as overridden by GBK) as `zueci_gbk_u()` did, then the rest of GBK
+$gbk_mb2_u = array_fill(0, 126 * 191, 0);
+foreach ($gb2312_mbs_u as $mb => $u) {
+    $gbk_mb2_u[mb2_ind($mb)] = $u;
+}
+$gbk_mb2_u[mb2_ind(0xA1A4)] = 0x00B7; // MIDDLE DOT (GB 2312 U+30FB KATAKANA MIDDLE DOT)
+$gbk_mb2_u[mb2_ind(0xA1AA)] = 0x2014; // EM DASH (GB 2312 U+2015 HORIZONTAL BAR)
+for ($i = 0, $cnt = count($mbs); $i < $cnt; $i++) {
+    if (!$gbk_mb2_u[mb2_ind($mbs[$i])]) {
+        $gbk_mb2_u[mb2_ind($mbs[$i])] = $us[$i];
+    }
+}
+
 $u_mb = $mbs;
 array_multisort($us, $u_mb);
 
@@ -644,7 +909,7 @@ for ($u = 0x4E00; $u <= 0x9FAF; $u += 16) {
         }
     }
     $gbk_uro_u[] = $used;
-    $gbk_uro_mb_ind[] = $u_i;
+    $gbk_uro_mb_ind[] = $u_i - $start_u_i; // Into URO-only `zueci_gbk_u_mb[]`
     $u_i = $next_u_i;
 }
 
@@ -655,52 +920,15 @@ out_uro_tabs($out, 'gbk', $gbk_uro_u, $gbk_uro_mb_ind);
 $u_u = $us;
 array_splice($u_u, $start_u_i, $end_u_i - $start_u_i + 1);
 
-// Multibyte ordered array
-$mb_u = array();
-$u_mb_search = array_flip($u_mb);
-
-$max_j = 0xFF;
-for ($i = 0x81; $i < 0xFF; $i++) {
-	if ($i == 0xA1) {
-		$i = 0xA8;
-		$max_j = 0xA1;
-	}
-
-	for ($j = 0x40; $j < $max_j; $j++) {
-		if ($j == 0x7F) $j = 0x80;
-
-		$k = ($i << 8) | $j;
-		if (isset($u_mb_search[$k])) {
-			$mb_u[] = $us[$u_mb_search[$k]];
-		} else {
-			$mb_u[] = 0;
-		}
-
-		if ($i == 0xFE && $j == 0x4F) break;
-	}
-}
+// Split multibyte table into URO and non-URO
+$uro_mb = array_slice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
+array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
 
 // Output GBK tables
-out_tabs($out, 'gbk', $u_u, $u_mb, $mb_u, true /*no_ind*/);
+out_tabs($out, 'gbk', array(), $uro_mb, array(), true /*no_u_ind*/, '', 'URO multibyte values sorted in Unicode order');
+out_pg_tabs($out, 'gbk', $u_u, $u_mb);
 
-// Remove URO block from multibyte table
-array_splice($u_mb, $start_u_i, $end_u_i - $start_u_i + 1);
-// Sort into multibyte order
-array_multisort($u_mb, $u_u);
-
-$cnt = count($u_mb);
-$out[] = '';
-$out[] = '#ifndef ZUECI_EMBED_NO_TO_UTF8';
-$out[] = '/* Non-URO multibyte values in multibyte order */';
-$out[] = 'static const zueci_u16 zueci_gbk_nonuro_mb[' . $cnt . '] = {';
-out_tab_entries($out, $u_mb, $cnt);
-$out[] = '};';
-$out[] = '';
-$out[] = '/* Non-URO Unicode values in multibyte order */';
-$out[] = 'static const zueci_u16 zueci_gbk_nonuro_u[' . $cnt . '] = {';
-out_tab_entries($out, $u_u, $cnt);
-$out[] = '};';
-$out[] = '#endif /* ZUECI_EMBED_NO_TO_UTF8 */';
+out_mb2_tab($out, 'gbk', $gbk_mb2_u, 'Unicode values (incl. GB 2312) indexed by `(lead - 0x81) * 191 + trail - 0x40`, 0 if none');
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_GBK_H */';
@@ -832,10 +1060,27 @@ for ($i = 1, $cnt = count($gb18030_4_u_b); $i < $cnt; $i++) {
 
 // Output GB 18030 tables
 
-$u_us2 = $us2; // Keep original unsorted array
-$u_mb2 = $mbs2;
-array_multisort($u_us2, $u_mb2);
-out_tabs($out, 'gb18030_2', $u_us2, $u_mb2, array(), true /*no_ind*/);
+$out[] = '';
+$out[] = '/* Minimal perfect hash slot of 16-bit key `k` in table of `n` entries with 128 bucket displacements `d`,';
+$out[] = '   used for the sparse 2-byte tables */';
+$out[] = '#define ZUECI_GB18030_PHASH(k, d, n) \\';
+$out[] = '    (((((zueci_u32) ((k) ^ (d)[((zueci_u32) (k) * 0x9E3779B1) >> 25]) * 0x85EBCA6B) >> 16) * (n)) >> 16)';
+
+$u_us2 = array();
+$u_mb2 = array();
+foreach (phash($us2, $u_d2) as $i) {
+    $u_us2[] = $us2[$i];
+    $u_mb2[] = $mbs2[$i];
+}
+out_tabs($out, 'gb18030_2', $u_us2, $u_mb2, array(), true /*no_ind*/, 'Unicode codepoints in perfect hash order',
+    'Multibyte values in Unicode perfect hash order');
+$out[] = '';
+$out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
+$out[] = '/* Perfect hash bucket displacements for `zueci_gb18030_2_u_u` */';
+$out[] = 'static const zueci_u16 zueci_gb18030_2_u_d[128] = {';
+out_tab_entries($out, $u_d2, 128, true /*not_hex*/);
+$out[] = '};';
+$out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
 
 // Start codepoints `gb18030_4_u_b` array not needed by `zueci_u_gb18030()`
 $cnt = count($gb18030_4_u_e);
@@ -846,18 +1091,56 @@ out_tab_entries($out, $gb18030_4_u_e, $cnt);
 $out[] = '};';
 $cnt = count($gb18030_4_u_mb_o);
 $out[] = '';
-$out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
 $out[] = '/* Cumulative gaps between Unicode blocks mapping consecutively to 4-byte multibyte blocks,';
 $out[] = '   used to adjust multibyte offsets */';
 $out[] = 'static const zueci_u16 zueci_gb18030_4_u_mb_o[' . $cnt .'] = {';
 out_tab_entries($out, $gb18030_4_u_mb_o, $cnt, true /*not_hex*/);
 $out[] = '};';
+
+// Bucket indexes into the blocks, by codepoint for `zueci_u_gb18030()` and by multibyte linear offset for
+// `zueci_gb18030_u()` (end multibyte codepoints `gb18030_4_mb_e` not needed, as linear offsets contiguous)
+
+$u_keys = array();
+foreach ($us4 as $u) {
+    $u_keys[$u] = lower_bound($gb18030_4_u_e, $u);
+}
+bucket_ind($gb18030_4_u_e, $u_keys, 0xFFFF, $u_ind, $u_ind2);
+
+$mb_e_lin = array();
+foreach ($gb18030_4_mb_e as $mb) {
+    $mb_e_lin[] = gb18030_mb4_lin($mb);
+}
+$mb_keys = array();
+for ($lin = 0, $max_lin = $mb_e_lin[count($mb_e_lin) - 1]; $lin <= $max_lin; $lin++) {
+    $mb_keys[$lin] = lower_bound($mb_e_lin, $lin);
+}
+bucket_ind($mb_e_lin, $mb_keys, $max_lin, $mb_ind, $mb_ind2);
+
+$out[] = '';
+$out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
+$out[] = '/* Bucket index of Unicode codepoints into `zueci_gb18030_4_u_e`, indexed by `u >> 7`: if < 0x100 the index of the';
+$out[] = '   first block ending at or after the bucket start, else 0x100 + the 64-entry page in `zueci_gb18030_4_u_ind2`';
+$out[] = '   to index by `(u >> 1) & 0x3F` instead. Either way at most one correction step is needed */';
+$out[] = 'static const zueci_u16 zueci_gb18030_4_u_ind[' . count($u_ind) .'] = {';
+out_tab_entries($out, $u_ind, count($u_ind), true /*not_hex*/);
+$out[] = '};';
+$out[] = '';
+$out[] = '/* Second level of `zueci_gb18030_4_u_ind` for buckets with multiple close block ends */';
+$out[] = 'static const unsigned char zueci_gb18030_4_u_ind2[' . count($u_ind2) .'] = {';
+out_tab_entries($out, $u_ind2, count($u_ind2), true /*not_hex*/);
+$out[] = '};';
 $out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
 $out[] = '';
 $out[] = '#ifndef ZUECI_EMBED_NO_TO_UTF8';
-$out[] = '/* End multibyte codepoints of blocks mapping consecutively to 4-byte multibyte blocks */';
-$out[] = 'static const zueci_u32 zueci_gb18030_4_mb_e[' . $cnt .'] = {';
-out_tab_entries($out, $gb18030_4_mb_e, $cnt);
+$out[] = '/* Bucket index of 4-byte multibyte linear offsets into the blocks, indexed by `offset >> 7` and arranged as';
+$out[] = '   `zueci_gb18030_4_u_ind` */';
+$out[] = 'static const zueci_u16 zueci_gb18030_4_mb_ind[' . count($mb_ind) .'] = {';
+out_tab_entries($out, $mb_ind, count($mb_ind), true /*not_hex*/);
+$out[] = '};';
+$out[] = '';
+$out[] = '/* Second level of `zueci_gb18030_4_mb_ind` */';
+$out[] = 'static const unsigned char zueci_gb18030_4_mb_ind2[' . count($mb_ind2) .'] = {';
+out_tab_entries($out, $mb_ind2, count($mb_ind2), true /*not_hex*/);
 $out[] = '};';
 $out[] = '#endif /* ZUECI_EMBED_NO_TO_UTF8 */';
 
@@ -869,20 +1152,68 @@ for ($i = 0, $cnt = count($pua_change_2005_mb); $i < $cnt; $i++) {
     array_splice($us2, $j, 1);
     assert(array_search($pua_change_2005_mb[$i], $mbs2) !== false); // Make sure non-PUA mapping exists
 }
-array_multisort($mbs2, $us2);
-$cnt = count($mbs2);
-$out[] = '';
-$out[] = '#ifndef ZUECI_EMBED_NO_TO_UTF8';
-$out[] = '/* Multibyte values sorted in multibyte order */';
-$out[] = 'static const zueci_u16 zueci_gb18030_2_mb_mb[' . $cnt .'] = {';
-out_tab_entries($out, $mbs2, $cnt);
-$out[] = '};';
+
+// Dense 2-byte table, GBK first, then user-defined PUA, then the rest, as `zueci_gb18030_u()` did, with non-BMP
+// (formerly PUA) left 0 to be dealt with programmatically
+$gb18030_mb2_u = $gbk_mb2_u;
+for ($c1 = 0x81; $c1 <= 0xFE; $c1++) {
+    for ($c2 = 0x40; $c2 <= 0xFE; $c2++) {
+        $ind = mb2_ind(($c1 << 8) | $c2);
+        if ($c2 == 0x7F || $gb18030_mb2_u[$ind]) {
+            continue;
+        }
+        if ((($c1 >= 0xAA && $c1 <= 0xAF) || $c1 >= 0xF8) && $c2 >= 0xA1) { // UDA-1/2
+            $gb18030_mb2_u[$ind] = 0xE000 + (0xFF - 0xA0 - 1) * ($c1 - ($c1 >= 0xF8 ? 0xF2 : 0xAA)) + $c2 - 0xA1;
+        } else if ($c1 >= 0xA1 && $c1 <= 0xA7 && $c2 <= 0xA1) { // UDA-3
+            $gb18030_mb2_u[$ind] = 0xE4C6 + (0xA1 - 0x40 - 1) * ($c1 - 0xA1) + $c2 - 0x40 - ($c2 > 0x7F);
+        }
+    }
+}
+$non_bmp_mb = array(0xFE51, 0xFE52, 0xFE53, 0xFE6C, 0xFE76, 0xFE91);
+for ($i = 0, $cnt = count($mbs2); $i < $cnt; $i++) {
+    if (!$gb18030_mb2_u[mb2_ind($mbs2[$i])] && !in_array($mbs2[$i], $non_bmp_mb)) {
+        $gb18030_mb2_u[mb2_ind($mbs2[$i])] = $us2[$i];
+    }
+}
+
+out_mb2_tab($out, 'gb18030', $gb18030_mb2_u, '2-byte Unicode values (incl. GBK and user-defined PUA) indexed by `(lead - 0x81) * 191 + trail - 0x40`, 0 if none' . "\n" . '   or non-BMP');
+
+// BMP class map routing `zueci_u_gbk()` and `zueci_u_gb18030()`: 0 1-byte, 1 2-byte as GB 2312 (and so as GBK),
+// 2 other 2-byte (GBK, user-defined PUA or perfect hash), 3 4-byte
+$gb2312_u_mbs = array_flip($gb2312_mbs_u);
+$mb2_search = array(); // 2-byte Unicode to multibyte, 0 if not a decode
+foreach ($gb18030_mb2_u as $ind => $u) {
+    if ($u) {
+        $mb2_search[$u] = ((intdiv($ind, 191) + 0x81) << 8) | ($ind % 191 + 0x40);
+    }
+}
+foreach ($u_us2 as $u) {
+    if (!isset($mb2_search[$u])) {
+        $mb2_search[$u] = 0;
+    }
+}
+for ($u = 0xE000; $u <= 0xE765; $u++) {
+    if (!isset($mb2_search[$u])) {
+        $mb2_search[$u] = 0;
+    }
+}
+$cls = array_fill(0, 0x4000, 0);
+for ($u = 0x80; $u < 0x10000; $u++) {
+    if (isset($mb2_search[$u])) {
+        $c = isset($gb2312_u_mbs[$u]) && $gb2312_u_mbs[$u] === $mb2_search[$u] ? 1 : 2;
+    } else {
+        $c = 3;
+    }
+    $cls[$u >> 2] |= $c << (($u & 3) << 1);
+}
 $out[] = '';
-$out[] = '/* Unicode values sorted in multibyte order */';
-$out[] = 'static const zueci_u16 zueci_gb18030_2_mb_u[' . $cnt .'] = {';
-out_tab_entries($out, $us2, $cnt);
+$out[] = '#ifndef ZUECI_EMBED_NO_TO_ECI';
+$out[] = '/* Classes of BMP codepoints, 2 bits each indexed by `u >> 2` and `(u & 3) << 1`, to route `zueci_u_gbk()` and';
+$out[] = '   `zueci_u_gb18030()`: 0 1-byte, 1 2-byte as GB 2312, 2 other 2-byte (GBK or GB 18030), 3 4-byte */';
+$out[] = 'static const unsigned char zueci_gb18030_cls[16384] = {';
+out_tab_entries($out, $cls, 0x4000, true /*not_hex*/);
 $out[] = '};';
-$out[] = '#endif /* ZUECI_EMBED_NO_TO_UTF8 */';
+$out[] = '#endif /* ZUECI_EMBED_NO_TO_ECI */';
 
 $out[] = '';
 $out[] = '#endif /* ZUECI_GB18030_H */';
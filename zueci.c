@@ -12,27 +12,83 @@
 #include "zueci.h"
 #include "zueci_common.h"
 
-//#include "zueci_sb.h"
-//#include "zueci_big5.h"
-#include "zueci_gb18030.h"
-#include "zueci_gb2312.h"
-#include "zueci_gbk.h"
-//#include "zueci_ksx1001.h"
-//#include "zueci_sjis.h"
+/* SIMD intrinsics used for bulk ASCII runs - compile-time only (the UTF-8 validator excepted, see below), scalar
+   fallback otherwise */
+#if defined(__AVX2__)
+#  define ZUECI_AVX2
+#  include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define ZUECI_SSE2
+#  include <emmintrin.h>
+#  if defined(__SSSE3__)
+#    define ZUECI_SSSE3
+#    include <tmmintrin.h>
+#  endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#  define ZUECI_NEON
+#  include <arm_neon.h>
+#endif
+
+/* GCC/clang on x86 without AVX2 compiled in: build both the AVX2 and SSSE3 Keiser-Lemire UTF-8 validators and
+   choose at run time using `__builtin_cpu_supports()` - define ZUECI_NO_SIMD_DISPATCH to only use what's compiled in */
+#if !defined(ZUECI_AVX2) && !defined(ZUECI_NO_SIMD_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) \
+        && ((defined(__clang__) && __clang_major__ >= 4) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 5))
+#  define ZUECI_KL_DISPATCH
+#  define ZUECI_KL_TARGET(isa) __attribute__((target(isa)))
+#  include <immintrin.h>
+#else
+#  define ZUECI_KL_TARGET(isa)
+#endif
+
+/* Multi-threading for `zueci_utf8_to_eci_mt()` and `zueci_eci_to_utf8_mt()` - serial otherwise */
+#ifdef ZUECI_THREADS
+#  ifdef _WIN32
+#    include <windows.h>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
+/* Single-byte ECIs with tables in "zueci_sb.h" (i.e. all except ECIs 1 & 3 ISO/IEC 8859-1) */
+#define ZUECI_MASK_SB_TABS      ((ZUECI_ECI_BIT(19) - 1 - ZUECI_ECI_BIT(1) - ZUECI_ECI_BIT(3) - ZUECI_ECI_BIT(14)) \
+                                    | ZUECI_ECI_BIT(21) | ZUECI_ECI_BIT(22) | ZUECI_ECI_BIT(23) | ZUECI_ECI_BIT(24))
+/* ECIs with tables, i.e. those that may be aliased to `zueci_u_none()` and `zueci_none_u()` if not built */
+#define ZUECI_MASK_TABS         (ZUECI_MASK_SB_TABS | ZUECI_ECI_BIT(20) | ZUECI_ECI_BIT(28) | ZUECI_ECI_BIT(29) \
+                                    | ZUECI_ECI_BIT(30) | ZUECI_ECI_BIT(31) | ZUECI_ECI_BIT(32))
+
+/* Without GB ECIs there's nothing to put in the BMP tables or the encode cache */
+#if !ZUECI_HAS_ECI(29) && !ZUECI_HAS_ECI(31) && !ZUECI_HAS_ECI(32)
+#  undef ZUECI_BMP_TABLES
+#  undef ZUECI_ENCODE_CACHE
+#endif
 
 /* Whether codepoint `u` valid Unicode */
 #define ZUECI_IS_VALID_UNICODE(u) ((u) < 0xD800 || ((u) >= 0xE000 && (u) <= 0x10FFFF))
 
-/* Put 4 bytes into `zueci_u32` */
-#define ZUECI_4BYTES_U32(c1, c2, c3, c4) \
-    (((zueci_u32) (c1) << 24) | ((zueci_u32) (c2) << 16) | ((zueci_u32) (c3) << 8) | (c4))
-
 /* Utility funcs */
 
-/* Whether `eci` valid character set ECI */
+/* Whether `eci` valid character set ECI (and built) */
 static int zueci_is_valid_eci(const int eci) {
-    return (eci <= 35 && eci >= 0 && eci != 14 && eci != 19) || eci == 170 || eci == 899;
+    return ((eci <= 35 && eci >= 0 && eci != 14 && eci != 19) || eci == 170 || eci == 899) && ZUECI_HAS_ECI(eci);
+}
+
+#if (ZUECI_ECIS_BUILT & ZUECI_MASK_TABS) != ZUECI_MASK_TABS
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Stand-in for the Unicode to ECI routine of an ECI not built - never called as `zueci_is_valid_eci()` fails */
+static int zueci_u_none(const zueci_u32 u, unsigned char *dest) {
+    (void)u; (void)dest;
+    return 0;
+}
+#endif
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* Stand-in for the ECI to Unicode routine of an ECI not built - never called as `zueci_is_valid_eci()` fails */
+static int zueci_none_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
+    (void)src; (void)len; (void)flags; (void)p_u;
+    return 0;
 }
+#endif
+#endif /* (ZUECI_ECIS_BUILT & ZUECI_MASK_TABS) != ZUECI_MASK_TABS */
 
 /* State machine to decode UTF-8 to Unicode codepoints (state 0 means done, state 12 means error) */
 static unsigned int zueci_decode_utf8(unsigned int *p_state, zueci_u32 *p_u, const unsigned char byte) {
@@ -87,22 +143,350 @@ ZUECI_INTERN unsigned int zueci_decode_utf8_test(unsigned int *p_state, zueci_u3
 }
 #endif
 
-/* Whether string valid UTF-8 */
-static int zueci_is_valid_utf8(const unsigned char src[], const int len) {
+/* Copy the run of ASCII (< 0x80) bytes at the start of `src` of length `len` to `dest`, returning run length.
+   Processes 32/16 bytes at a time if AVX2/SSE2/NEON available, stopping at the first block with a non-ASCII byte */
+static int zueci_ascii_copy(const unsigned char src[], const int len, unsigned char dest[]) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + len;
+    unsigned char *d = dest;
+
+#ifdef ZUECI_AVX2
+    while (se - s >= 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) s);
+        if (_mm256_movemask_epi8(v)) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i *) d, v);
+        s += 32;
+        d += 32;
+    }
+#endif
+#if defined(ZUECI_SSE2)
+    while (se - s >= 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i *) s);
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *) d, v);
+        s += 16;
+        d += 16;
+    }
+#elif defined(ZUECI_NEON)
+    while (se - s >= 16) {
+        const uint8x16_t v = vld1q_u8(s);
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        vst1q_u8(d, v);
+        s += 16;
+        d += 16;
+    }
+#endif
+    while (s < se && *s < 0x80) {
+        *d++ = *s++;
+    }
+    return (int) (s - src);
+}
+
+#if defined(ZUECI_AVX2) || defined(ZUECI_SSSE3) || defined(ZUECI_NEON) || defined(ZUECI_KL_DISPATCH)
+/* Keiser-Lemire UTF-8 validation nibble lookup tables, see "Validating UTF-8 In Less Than One Instruction Per Byte"
+   (https://arxiv.org/abs/2010.03090). Each entry is a bitmask of the errors the nibble may be part of */
+#define ZUECI_KL_TOO_SHORT      0x01 /* Lead or ASCII followed by continuation */
+#define ZUECI_KL_TOO_LONG       0x02 /* ASCII followed by continuation */
+#define ZUECI_KL_OVERLONG_3     0x04 /* E0 80..9F */
+#define ZUECI_KL_TOO_LARGE      0x08 /* F4 90..BF, F5..FF */
+#define ZUECI_KL_SURROGATE      0x10 /* ED A0..BF */
+#define ZUECI_KL_OVERLONG_2     0x20 /* C0..C1 */
+#define ZUECI_KL_TOO_LARGE_1000 0x40 /* F5..FF 80..8F */
+#define ZUECI_KL_OVERLONG_4     0x40 /* F0 80..8F */
+#define ZUECI_KL_TWO_CONTS      0x80 /* Continuation followed by continuation (checked separately) */
+#define ZUECI_KL_CARRY          (ZUECI_KL_TOO_SHORT | ZUECI_KL_TOO_LONG | ZUECI_KL_TWO_CONTS)
+
+/* Indexed by high nibble of previous byte */
+static const unsigned char zueci_kl_byte_1_high[16] = {
+    ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, /* 0x00-3F */
+    ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, ZUECI_KL_TOO_LONG, /* 0x40-7F */
+    ZUECI_KL_TWO_CONTS, ZUECI_KL_TWO_CONTS, ZUECI_KL_TWO_CONTS, ZUECI_KL_TWO_CONTS, /* 0x80-BF */
+    ZUECI_KL_TOO_SHORT | ZUECI_KL_OVERLONG_2, /* 0xC0-CF */
+    ZUECI_KL_TOO_SHORT, /* 0xD0-DF */
+    ZUECI_KL_TOO_SHORT | ZUECI_KL_OVERLONG_3 | ZUECI_KL_SURROGATE, /* 0xE0-EF */
+    ZUECI_KL_TOO_SHORT | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000 | ZUECI_KL_OVERLONG_4, /* 0xF0-FF */
+};
+
+/* Indexed by low nibble of previous byte */
+static const unsigned char zueci_kl_byte_1_low[16] = {
+    ZUECI_KL_CARRY | ZUECI_KL_OVERLONG_3 | ZUECI_KL_OVERLONG_2 | ZUECI_KL_OVERLONG_4, /* 0x?0 */
+    ZUECI_KL_CARRY | ZUECI_KL_OVERLONG_2, /* 0x?1 */
+    ZUECI_KL_CARRY, ZUECI_KL_CARRY, /* 0x?2-3 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE, /* 0x?4 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?5 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?6 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?7 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?8 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?9 */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?A */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?B */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?C */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000 | ZUECI_KL_SURROGATE, /* 0x?D */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?E */
+    ZUECI_KL_CARRY | ZUECI_KL_TOO_LARGE | ZUECI_KL_TOO_LARGE_1000, /* 0x?F */
+};
+
+/* Indexed by high nibble of current byte */
+static const unsigned char zueci_kl_byte_2_high[16] = {
+    ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, /* 0x00-3F */
+    ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, /* 0x40-7F */
+    ZUECI_KL_TOO_LONG | ZUECI_KL_OVERLONG_2 | ZUECI_KL_TWO_CONTS | ZUECI_KL_OVERLONG_3 | ZUECI_KL_TOO_LARGE_1000
+        | ZUECI_KL_OVERLONG_4, /* 0x80-8F */
+    ZUECI_KL_TOO_LONG | ZUECI_KL_OVERLONG_2 | ZUECI_KL_TWO_CONTS | ZUECI_KL_OVERLONG_3 | ZUECI_KL_TOO_LARGE,
+        /* 0x90-9F */
+    ZUECI_KL_TOO_LONG | ZUECI_KL_OVERLONG_2 | ZUECI_KL_TWO_CONTS | ZUECI_KL_SURROGATE | ZUECI_KL_TOO_LARGE,
+        /* 0xA0-AF */
+    ZUECI_KL_TOO_LONG | ZUECI_KL_OVERLONG_2 | ZUECI_KL_TWO_CONTS | ZUECI_KL_SURROGATE | ZUECI_KL_TOO_LARGE,
+        /* 0xB0-BF */
+    ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, ZUECI_KL_TOO_SHORT, /* 0xC0-FF */
+};
+#endif /* ZUECI_AVX2 || ZUECI_SSSE3 || ZUECI_NEON || ZUECI_KL_DISPATCH */
+
+#if defined(ZUECI_AVX2) || defined(ZUECI_KL_DISPATCH)
+/* Validate and copy the whole 32-byte blocks of `src` of length `len` (>= 32) to `dest` using AVX2, returning
+   the number of bytes done, or -1 if invalid. Any sequence incomplete at the end of the blocks is left unchecked */
+ZUECI_KL_TARGET("avx2")
+static int zueci_utf8_kl_avx2(const unsigned char src[], const int len, unsigned char dest[]) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + len;
+    unsigned char *d = dest;
+    const __m256i b1h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) zueci_kl_byte_1_high));
+    const __m256i b1l = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) zueci_kl_byte_1_low));
+    const __m256i b2h = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) zueci_kl_byte_2_high));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i high_bit = _mm256_set1_epi8((char) 0x80);
+    const __m256i third_sub = _mm256_set1_epi8(0xE0 - 0x80);
+    const __m256i fourth_sub = _mm256_set1_epi8(0xF0 - 0x80);
+    /* Bytes > these in last 3 positions are leads needing more bytes */
+    const __m256i incomplete_max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+    __m256i prev = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    __m256i error = _mm256_setzero_si256();
+    do {
+        const __m256i in = _mm256_loadu_si256((const __m256i *) s);
+        _mm256_storeu_si256((__m256i *) d, in);
+        if (!_mm256_movemask_epi8(in)) {
+            error = _mm256_or_si256(error, prev_incomplete);
+        } else {
+            const __m256i straddle = _mm256_permute2x128_si256(prev, in, 0x21);
+            const __m256i prev1 = _mm256_alignr_epi8(in, straddle, 15);
+            const __m256i prev2 = _mm256_alignr_epi8(in, straddle, 14);
+            const __m256i prev3 = _mm256_alignr_epi8(in, straddle, 13);
+            const __m256i special = _mm256_and_si256(_mm256_and_si256(
+                        _mm256_shuffle_epi8(b1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                        _mm256_shuffle_epi8(b1l, _mm256_and_si256(prev1, nibble))),
+                        _mm256_shuffle_epi8(b2h, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+            const __m256i must_23 = _mm256_and_si256(_mm256_or_si256(_mm256_subs_epu8(prev2, third_sub),
+                        _mm256_subs_epu8(prev3, fourth_sub)), high_bit);
+            error = _mm256_or_si256(error, _mm256_xor_si256(must_23, special));
+            prev_incomplete = _mm256_subs_epu8(in, incomplete_max);
+        }
+        prev = in;
+        s += 32;
+        d += 32;
+    } while (se - s >= 32);
+    if (!_mm256_testz_si256(error, error)) {
+        return -1;
+    }
+    return (int) (s - src);
+}
+#endif
+
+#if (defined(ZUECI_SSSE3) && !defined(ZUECI_AVX2)) || defined(ZUECI_KL_DISPATCH)
+/* Validate and copy the whole 16-byte blocks of `src` of length `len` (>= 16) to `dest` using SSSE3, returning
+   the number of bytes done, or -1 if invalid. Any sequence incomplete at the end of the blocks is left unchecked */
+ZUECI_KL_TARGET("ssse3")
+static int zueci_utf8_kl_ssse3(const unsigned char src[], const int len, unsigned char dest[]) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + len;
+    unsigned char *d = dest;
+    const __m128i b1h = _mm_loadu_si128((const __m128i *) zueci_kl_byte_1_high);
+    const __m128i b1l = _mm_loadu_si128((const __m128i *) zueci_kl_byte_1_low);
+    const __m128i b2h = _mm_loadu_si128((const __m128i *) zueci_kl_byte_2_high);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i high_bit = _mm_set1_epi8((char) 0x80);
+    const __m128i third_sub = _mm_set1_epi8(0xE0 - 0x80);
+    const __m128i fourth_sub = _mm_set1_epi8(0xF0 - 0x80);
+    const __m128i incomplete_max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+    __m128i prev = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+    do {
+        const __m128i in = _mm_loadu_si128((const __m128i *) s);
+        _mm_storeu_si128((__m128i *) d, in);
+        if (!_mm_movemask_epi8(in)) {
+            error = _mm_or_si128(error, prev_incomplete);
+        } else {
+            const __m128i prev1 = _mm_alignr_epi8(in, prev, 15);
+            const __m128i prev2 = _mm_alignr_epi8(in, prev, 14);
+            const __m128i prev3 = _mm_alignr_epi8(in, prev, 13);
+            const __m128i special = _mm_and_si128(_mm_and_si128(
+                        _mm_shuffle_epi8(b1h, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                        _mm_shuffle_epi8(b1l, _mm_and_si128(prev1, nibble))),
+                        _mm_shuffle_epi8(b2h, _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+            const __m128i must_23 = _mm_and_si128(_mm_or_si128(_mm_subs_epu8(prev2, third_sub),
+                        _mm_subs_epu8(prev3, fourth_sub)), high_bit);
+            error = _mm_or_si128(error, _mm_xor_si128(must_23, special));
+            prev_incomplete = _mm_subs_epu8(in, incomplete_max);
+        }
+        prev = in;
+        s += 16;
+        d += 16;
+    } while (se - s >= 16);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF) {
+        return -1;
+    }
+    return (int) (s - src);
+}
+#endif
+
+#if defined(ZUECI_NEON)
+/* Validate and copy the whole 16-byte blocks of `src` of length `len` (>= 16) to `dest` using NEON, returning
+   the number of bytes done, or -1 if invalid. Any sequence incomplete at the end of the blocks is left unchecked */
+static int zueci_utf8_kl_neon(const unsigned char src[], const int len, unsigned char dest[]) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + len;
+    unsigned char *d = dest;
+    static const unsigned char incomplete_max_bytes[16] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+    };
+    const uint8x16_t b1h = vld1q_u8(zueci_kl_byte_1_high);
+    const uint8x16_t b1l = vld1q_u8(zueci_kl_byte_1_low);
+    const uint8x16_t b2h = vld1q_u8(zueci_kl_byte_2_high);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    const uint8x16_t high_bit = vdupq_n_u8(0x80);
+    const uint8x16_t third_sub = vdupq_n_u8(0xE0 - 0x80);
+    const uint8x16_t fourth_sub = vdupq_n_u8(0xF0 - 0x80);
+    const uint8x16_t incomplete_max = vld1q_u8(incomplete_max_bytes);
+    uint8x16_t prev = vdupq_n_u8(0);
+    uint8x16_t prev_incomplete = vdupq_n_u8(0);
+    uint8x16_t error = vdupq_n_u8(0);
+    do {
+        const uint8x16_t in = vld1q_u8(s);
+        vst1q_u8(d, in);
+        if (vmaxvq_u8(in) < 0x80) {
+            error = vorrq_u8(error, prev_incomplete);
+        } else {
+            const uint8x16_t prev1 = vextq_u8(prev, in, 15);
+            const uint8x16_t prev2 = vextq_u8(prev, in, 14);
+            const uint8x16_t prev3 = vextq_u8(prev, in, 13);
+            const uint8x16_t special = vandq_u8(vandq_u8(vqtbl1q_u8(b1h, vshrq_n_u8(prev1, 4)),
+                        vqtbl1q_u8(b1l, vandq_u8(prev1, nibble))), vqtbl1q_u8(b2h, vshrq_n_u8(in, 4)));
+            const uint8x16_t must_23 = vandq_u8(vorrq_u8(vqsubq_u8(prev2, third_sub),
+                        vqsubq_u8(prev3, fourth_sub)), high_bit);
+            error = vorrq_u8(error, veorq_u8(must_23, special));
+            prev_incomplete = vqsubq_u8(in, incomplete_max);
+        }
+        prev = in;
+        s += 16;
+        d += 16;
+    } while (se - s >= 16);
+    if (vmaxvq_u8(error)) {
+        return -1;
+    }
+    return (int) (s - src);
+}
+#endif
+/* Copy `src` of length `len` to `dest` if valid UTF-8, returning 1, else return 0 (`dest` contents undefined).
+   Validates 32/16 bytes at a time using the Keiser-Lemire lookup algorithm if AVX2/SSSE3/NEON available (chosen at
+   run time if `ZUECI_KL_DISPATCH`), with the remainder (and everything otherwise) done by the DFA, ASCII runs
+   excepted */
+static int zueci_utf8_copy_valid(const unsigned char src[], const int len, unsigned char dest[]) {
     unsigned int state = 0;
     const unsigned char *s = src;
     const unsigned char *const se = src + len;
+    unsigned char *d = dest;
     zueci_u32 u;
+    int done = 0;
+
+#if defined(ZUECI_AVX2)
+    if (len >= 32) {
+        done = zueci_utf8_kl_avx2(src, len, dest);
+    }
+#elif defined(ZUECI_KL_DISPATCH)
+    if (len >= 32 && __builtin_cpu_supports("avx2")) {
+        done = zueci_utf8_kl_avx2(src, len, dest);
+    } else if (len >= 16 && __builtin_cpu_supports("ssse3")) {
+        done = zueci_utf8_kl_ssse3(src, len, dest);
+    }
+#elif defined(ZUECI_SSSE3)
+    if (len >= 16) {
+        done = zueci_utf8_kl_ssse3(src, len, dest);
+    }
+#elif defined(ZUECI_NEON)
+    if (len >= 16) {
+        done = zueci_utf8_kl_neon(src, len, dest);
+    }
+#endif
+    if (done < 0) {
+        return 0;
+    }
+    s += done;
+    d += done;
+    if (s > src) {
+        /* Any sequence still incomplete at the end of the blocks hasn't been checked, so back up to its lead byte
+           (at most 3 back) and let the DFA redo it */
+        int i;
+        for (i = 1; i <= 3 && s[-i] >= 0x80; i++) {
+            if (s[-i] >= 0xC0) {
+                s -= i;
+                d -= i;
+                break;
+            }
+        }
+    }
 
     while (s < se) {
-        if (zueci_decode_utf8(&state, &u, *s++) == 12) {
+        if (*s < 0x80 && state == 0) {
+            const int run = zueci_ascii_copy(s, (int) (se - s), d);
+            s += run;
+            d += run;
+            continue;
+        }
+        if (zueci_decode_utf8(&state, &u, *s) == 12) {
             return 0;
         }
+        *d++ = *s++;
     }
 
     return state == 0;
 }
 
+/* Return the length of the run of ASCII (< 0x80) bytes at the start of `src` of length `len` - as
+   `zueci_ascii_copy()` but without the copying */
+static int zueci_ascii_len(const unsigned char src[], const int len) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + len;
+
+#ifdef ZUECI_AVX2
+    while (se - s >= 32 && !_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *) s))) {
+        s += 32;
+    }
+#endif
+#if defined(ZUECI_SSE2)
+    while (se - s >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) s))) {
+        s += 16;
+    }
+#elif defined(ZUECI_NEON)
+    while (se - s >= 16 && vmaxvq_u8(vld1q_u8(s)) < 0x80) {
+        s += 16;
+    }
+#endif
+    while (s < se && *s < 0x80) {
+        s++;
+    }
+    return (int) (s - src);
+}
+
 #ifndef ZUECI_EMBED_NO_TO_UTF8
 /* Convert Unicode codepoint `u` to UTF-8 `dest`, returning UTF-8 length */
 static int zueci_encode_utf8(const zueci_u32 u, unsigned char *dest) {
@@ -190,102 +574,32 @@ static int zueci_replacement_incr(const int eci, const unsigned char *src, const
 
 /* Single-byte & UTF-16/32 stuff */
 
+#if ZUECI_ECIS_BUILT & ZUECI_MASK_SB_TABS
 #ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode to ECIs 0 and 2 (bottom half ASCII, top half IBM CP 437) */
-static int zueci_u_cp437(const zueci_u32 u, unsigned char *dest) {
-/*    int s, e;
+/* Base single-byte routine to convert Unicode codepoint `u` via the two-level page table `pg_dir`, `pg`, `pg_sb`,
+   where `pg_dir` has `pg_dir_cnt` entries */
+static int zueci_u_sb(const zueci_u32 u, const unsigned char *pg_dir, const int pg_dir_cnt, const unsigned char *pg,
+            const unsigned char *pg_sb, unsigned char *dest) {
+    unsigned char c;
     if (u < 0x80) {
         *dest = (unsigned char) u;
         return 1;
     }
-
-    s = 0;
-    e = ZUECI_ASIZE(zueci_cp437_u_u) - 1;
-    while (s <= e) {
-        const int m = (s + e) >> 1;
-        if (zueci_cp437_u_u[m] < u) {
-            s = m + 1;
-        } else if (zueci_cp437_u_u[m] > u) {
-            e = m - 1;
-        } else {
-            *dest = zueci_cp437_u_sb[m];
-            return 1;
-        }
-    }*/
-    return 0;
-}
-#endif /* ZUECI_EMBED_NO_TO_ECI */
-
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECIs 0 and 2 ASCII/CP 437 to Unicode */
-static int zueci_cp437_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-//    const unsigned char c = *src;
-//    (void)len; (void)flags;
-//    if (c < 0x80) {
-//        *p_u = c;
-//        return 1;
-//    }
-//    *p_u = zueci_cp437_u_u[(int) zueci_cp437_sb_u[c - 0x80]]; /* No undefined */
-    return 1;
-}
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
-
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Base ISO/IEC 8859 routine to convert Unicode codepoint `u` */
-static int zueci_u_iso8859(const zueci_u32 u, const zueci_u16 *tab_s, const zueci_u16 *tab_u_u,
-            const unsigned char *tab_u_sb, int e, unsigned char *dest) {
-    int s;
-    if (u < 0xA0) {
-        if (u >= 0x80) { /* U+0080-9F fail */
-            return 0;
-        }
-        *dest = (unsigned char) u;
-        return 1;
-    }
-    if (u <= 0xFF) {
-        const zueci_u32 u2 = u - 0xA0;
-        if (tab_s[u2 >> 4] & ((zueci_u16) 1 << (u2 & 0xF))) {
-            *dest = (unsigned char) u; /* Straight-thru */
-            return 1;
-        }
-    }
-
-    s = 0;
-    while (s <= e) {
-        const int m = (s + e) >> 1;
-        if (tab_u_u[m] < u) {
-            s = m + 1;
-        } else if (tab_u_u[m] > u) {
-            e = m - 1;
-        } else {
-            *dest = tab_u_sb[m];
-            return 1;
-        }
+    if ((u >> 8) >= (zueci_u32) pg_dir_cnt
+            || !(c = pg_sb[(pg[(pg_dir[u >> 8] << 4) | ((u >> 4) & 0xF)] << 4) | (u & 0xF)])) {
+        return 0;
     }
-    return 0;
+    *dest = c;
+    return 1;
 }
 #endif /* ZUECI_EMBED_NO_TO_ECI */
 
 #ifndef ZUECI_EMBED_NO_TO_UTF8
-/* Base ISO/IEC 8859 routine to convert single-byte `c` */
-static int zueci_iso8859_u(const unsigned char c, const unsigned int flags, const zueci_u16 *tab_s,
-            const zueci_u16 *tab_u_u, const char *tab_sb_u, const int c2_max, zueci_u32 *p_u) {
-    unsigned char c2;
-    int idx;
-    if (c < 0xA0) {
-        if (c >= 0x80 && !(flags & ZUECI_FLAG_SB_STRAIGHT_THRU)) { /* U+0080-9F fail unless straight-thru */
-            return 0;
-        }
-        *p_u = c;
-        return 1;
-    }
-    c2 = c - 0xA0;
-    if (tab_s[c2 >> 4] & ((zueci_u16) 1 << (c2 & 0xF))) {
-        *p_u = c; /* Straight-thru */
-        return 1;
-    }
-    if (c2 < c2_max && (idx = (int) tab_sb_u[c2]) != -1) {
-        *p_u = tab_u_u[idx];
+/* Base single-byte routine to convert `c` via the 256-entry table `tab_sb_u` */
+static int zueci_sb_u(const unsigned char c, const unsigned int flags, const zueci_u16 *tab_sb_u, zueci_u32 *p_u) {
+    const zueci_u16 u = tab_sb_u[c];
+    if (u || !c) {
+        *p_u = u;
         return 1;
     }
     if (flags & ZUECI_FLAG_SB_STRAIGHT_THRU) {
@@ -295,61 +609,17 @@ static int zueci_iso8859_u(const unsigned char c, const unsigned int flags, cons
     return 0;
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
+#endif /* ZUECI_ECIS_BUILT & ZUECI_MASK_SB_TABS */
 
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Base Windows-125x routine to convert Unicode codepoint `u` */
-static int zueci_u_cp125x(const zueci_u32 u, const zueci_u16 *tab_s, const zueci_u16 *tab_u_u,
-            const unsigned char *tab_u_sb, int e, unsigned char *dest) {
-    int s;
-    if (u < 0x80) {
-        *dest = (unsigned char) u;
-        return 1;
-    }
-    if (u <= 0xFF && u >= 0xA0) {
-        const zueci_u32 u2 = u - 0xA0;
-        if (tab_s[u2 >> 4] & ((zueci_u16) 1 << (u2 & 0xF))) {
-            *dest = (unsigned char) u; /* Straight-thru */
-            return 1;
-        }
-    }
-
-    s = 0;
-    while (s <= e) {
-        const int m = (s + e) >> 1;
-        if (tab_u_u[m] < u) {
-            s = m + 1;
-        } else if (tab_u_u[m] > u) {
-            e = m - 1;
-        } else {
-            *dest = tab_u_sb[m];
-            return 1;
-        }
-    }
-    return 0;
-}
-#endif /* ZUECI_EMBED_NO_TO_ECI */
+#include "zueci_sb.h"
 
 #ifndef ZUECI_EMBED_NO_TO_UTF8
-/* Base Windows-125x routine to convert single-byte `c` */
-static int zueci_cp125x_u(const unsigned char c, const unsigned int flags, const zueci_u16 *tab_s,
-            const zueci_u16 *tab_u_u, const char *tab_sb_u, const int c_max, zueci_u32 *p_u) {
-    int idx;
-    if (c < 0x80) {
-        *p_u = c;
-        return 1;
-    }
-    if (c >= 0xA0) {
-        const unsigned char c2 = c - 0xA0;
-        if (tab_s[c2 >> 4] & ((zueci_u16) 1 << (c2 & 0xF))) {
-            *p_u = c; /* Straight-thru */
-            return 1;
-        }
-    }
-    if (c < c_max && (idx = (int) tab_sb_u[c - 0x80]) != -1) {
-        *p_u = tab_u_u[idx];
-        return 1;
-    }
-    if (flags & ZUECI_FLAG_SB_STRAIGHT_THRU) {
+/* ECIs 1 and 3 ISO/IEC 8859-1 to Unicode (U+0080-9F fail unless straight-thru) */
+static int zueci_iso8859_1_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+            zueci_u32 *p_u) {
+    const unsigned char c = *src;
+    (void)len;
+    if (c < 0x80 || c >= 0xA0 || (flags & ZUECI_FLAG_SB_STRAIGHT_THRU)) {
         *p_u = c;
         return 1;
     }
@@ -568,869 +838,851 @@ static int zueci_u_binary(const zueci_u32 u, unsigned char *dest) {
 
 /* Multibyte stuff */
 
-/* Acknowledgements to Bruno Haible <bruno@clisp.org> for a no. of techniques used here */
+#if !defined(ZUECI_EMBED_NO_TO_ECI) && defined(ZUECI_BMP_TABLES)
+/* Direct BMP tables for the GB ECIs (256K), built on first use from the routines above, so that encoding a BMP
+   codepoint is a single lookup - 0 if unmapped (or ASCII or a surrogate). GB 2312 is derived from the GBK entry.
+   Building is only thread-safe if `ZUECI_THREADS` - otherwise the library must only be called from one thread */
+static zueci_u16 zueci_gbk_bmp[0x10000];
+/* GB 18030 2-byters as is (>= 0x8140), 4-byters as the codepoint less their linear index from 0x81308130 (non-zero
+   and <= 0x6604), bar U+E7C7 */
+static zueci_u16 zueci_gb18030_bmp[0x10000];
+
+static void zueci_gb_bmp_build(void) {
+    unsigned char buf[4];
+    zueci_u32 u, ind;
+    int len;
+
+    for (u = 0x80; u < 0x10000; u++) {
+        if (u >= 0xD800 && u < 0xE000) { /* Surrogates */
+            continue;
+        }
+        if (zueci_u_gbk(u, buf)) {
+            zueci_gbk_bmp[u] = (zueci_u16) ((buf[0] << 8) | buf[1]);
+        }
+        if ((len = zueci_u_gb18030(u, buf)) == 2) {
+            zueci_gb18030_bmp[u] = (zueci_u16) ((buf[0] << 8) | buf[1]);
+        } else if (u != 0xE7C7) { /* Out of sequence (see `zueci_u_gb18030()`) so left as 0 */
+            assert(len == 4); /* All BMP non-surrogates map */
+            ind = (((buf[0] - 0x81) * 10 + (buf[1] - 0x30)) * 126 + (buf[2] - 0x81)) * 10 + (buf[3] - 0x30);
+            assert(ind < u && u - ind < 0x8140); /* Disjoint from 2-byters */
+            zueci_gb18030_bmp[u] = (zueci_u16) (u - ind);
+        }
+    }
+}
 
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Helper to lookup Unicode codepoint `u` in the URO (Unified Repertoire and Ordering) block (U+4E00-9FFF) */
-static int zueci_u_lookup_uro(const zueci_u32 u, const zueci_u16 *tab_u_u, const zueci_u16 *tab_mb_ind,
-            const zueci_u16 *tab_u_mb, unsigned char *dest) {
-    zueci_u32 u2 = (u - 0x4E00) >> 4; /* Blocks of 16 */
-    zueci_u32 v = (zueci_u32) 1 << (u & 0xF);
+#if defined(ZUECI_THREADS) && defined(_WIN32)
+static INIT_ONCE zueci_gb_bmp_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK zueci_gb_bmp_build_win(PINIT_ONCE once, PVOID param, PVOID *ctx) {
+    (void)once; (void)param; (void)ctx;
+    zueci_gb_bmp_build();
+    return TRUE;
+}
+#elif defined(ZUECI_THREADS)
+static pthread_once_t zueci_gb_bmp_once = PTHREAD_ONCE_INIT;
+#else
+static int zueci_gb_bmp_built = 0;
+#endif
+
+/* Build the GB BMP tables if not already built - thread-safe if `ZUECI_THREADS` */
+static void zueci_gb_bmp_init(void) {
+#if defined(ZUECI_THREADS) && defined(_WIN32)
+    InitOnceExecuteOnce(&zueci_gb_bmp_once, zueci_gb_bmp_build_win, NULL, NULL);
+#elif defined(ZUECI_THREADS)
+    pthread_once(&zueci_gb_bmp_once, zueci_gb_bmp_build);
+#else
+    if (!zueci_gb_bmp_built) {
+        zueci_gb_bmp_build();
+        zueci_gb_bmp_built = 1;
+    }
+#endif
+}
+
+/* Whether GBK `mb` (non-zero) is also GB 2312 - both bytes 0xA1-0xFE, less the GBK additions to rows 2, 6 and 8 and
+   the 2 row 1 mappings GBK changed (U+00B7 and U+2014 for GB 2312 U+30FB and U+2015) */
+static int zueci_gbk_is_gb2312(const zueci_u16 mb) {
+    if (mb < 0xA1A1 || (mb & 0xFF) < 0xA1 || (mb & 0xFF) == 0xFF) {
+        return 0;
+    }
+    return mb != 0xA1A4 && mb != 0xA1AA && (mb < 0xA2A1 || mb > 0xA2AA) && (mb < 0xA6E0 || mb > 0xA6F5)
+            && (mb < 0xA8BB || mb > 0xA8C0);
+}
+
+/* As `zueci_u_gb2312()` using `zueci_gbk_bmp[]` - `zueci_gb_bmp_init()` must have been called */
+static int zueci_u_gb2312_bmp(const zueci_u32 u, unsigned char *dest) {
     zueci_u16 mb;
-    if ((tab_u_u[u2] & v) == 0) {
+    if (u < 0x80) {
+        dest[0] = (unsigned char) u;
+        return 1;
+    }
+    if (u == 0x30FB || u == 0x2015) { /* Not GBK, or GBK different */
+        mb = u == 0x30FB ? 0xA1A4 : 0xA1AA;
+    } else if (u >= 0x10000 || !zueci_gbk_is_gb2312(mb = zueci_gbk_bmp[u])) {
         return 0;
     }
-    v = tab_u_u[u2] & (v - 1); /* Mask to bits prior to this one */
-    /* Count bits set (http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel) */
-    v = v - ((v >> 1) & 0x55555555);
-    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
-    v = (((v + (v >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
-    mb = tab_u_mb[tab_mb_ind[u2] + v];
     dest[0] = (unsigned char) (mb >> 8);
     dest[1] = (unsigned char) mb;
     return 2;
 }
 
-/* Unicode to ECI 20 Shift JIS */
-static int zueci_u_sjis(const zueci_u32 u, unsigned char *dest) {
-/*
-    if (u < 0x80 && u != 0x5C && u != 0x7E) { *//* Backslash & tilde re-mapped according to JIS X 0201 Roman *//*
+/* As `zueci_u_gbk()` using `zueci_gbk_bmp[]` - `zueci_gb_bmp_init()` must have been called */
+static int zueci_u_gbk_bmp(const zueci_u32 u, unsigned char *dest) {
+    zueci_u16 mb;
+    if (u < 0x80) {
         dest[0] = (unsigned char) u;
         return 1;
     }
-    *//* Special case URO block sequential mappings (considerably lessens size of `zueci_sjis_u_u[]` array) *//*
-    if (u >= 0x4E00 && u < 0xE000) { *//* 0xE000 next used value >= 0x4E00 *//*
-        if (u > 0x9FA0) {
-            return 0;
-        }
-        return zueci_u_lookup_uro(u, zueci_sjis_uro_u, zueci_sjis_uro_mb_ind, zueci_sjis_u_mb, dest);
+    if (u >= 0x10000 || !(mb = zueci_gbk_bmp[u])) {
+        return 0;
+    }
+    dest[0] = (unsigned char) (mb >> 8);
+    dest[1] = (unsigned char) mb;
+    return 2;
+}
+
+/* As `zueci_u_gb18030()` using `zueci_gb18030_bmp[]` - `zueci_gb_bmp_init()` must have been called */
+static int zueci_u_gb18030_bmp(const zueci_u32 u, unsigned char *dest) {
+    zueci_u32 mb, dv;
+    if (u < 0x80) {
+        dest[0] = (unsigned char) u;
+        return 1;
+    }
+    if (u >= 0x10000) {
+        return zueci_u_gb18030(u, dest);
     }
-    *//* PUA to user-defined (Table 4-86, Lunde, 2nd ed.) *//*
-    if (u >= 0xE000 && u <= 0xE757) {
-        const zueci_u32 u2 = u - 0xE000;
-        const unsigned char dv = (unsigned char) (u2 / (0xFC - 0x40));
-        const unsigned char md = (unsigned char) (u2 - dv * (0xFC - 0x40));
-        dest[0] = dv + 0xF0;
-        dest[1] = md + 0x40 + (md >= 0x3F);
+    mb = zueci_gb18030_bmp[u];
+    if (mb >= 0x8140) {
+        dest[0] = (unsigned char) (mb >> 8);
+        dest[1] = (unsigned char) mb;
         return 2;
     }
-    if (u >= zueci_sjis_u_u[0] && u <= zueci_sjis_u_u[ZUECI_ASIZE(zueci_sjis_u_u) - 1]) {
-        int s = 0;
-        int e = ZUECI_ASIZE(zueci_sjis_u_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_sjis_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_sjis_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_sjis_u_mb[u >= 0x4E00 ? m + 6356 : m]; *//* Adjust for URO block *//*
-                if (mb > 0xFF) {
-                    dest[0] = (unsigned char) (mb >> 8);
-                    dest[1] = (unsigned char) mb;
-                    return 2;
-                }
-                dest[0] = (unsigned char) mb;
-                return 1;
-            }
-        }
-    }*/
-    return 0;
+    if (u == 0xE7C7) {
+        return zueci_u_gb18030(u, dest);
+    }
+    mb = u - mb; /* Linear index from 0x81308130 */
+    dv = mb / 10; /* (0x39 - 0x30) + 1 */
+    dest[3] = (unsigned char) (mb - dv * 10 + 0x30);
+    mb = dv;
+    dv = mb / 126; /* (0xFE - 0x81) + 1 */
+    dest[2] = (unsigned char) (mb - dv * 126 + 0x81);
+    mb = dv;
+    dv = mb / 10;
+    dest[1] = (unsigned char) (mb - dv * 10 + 0x30);
+    dest[0] = (unsigned char) (dv + 0x81);
+    return 4;
 }
+#endif /* !ZUECI_EMBED_NO_TO_ECI && ZUECI_BMP_TABLES */
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_sjis_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_sjis(u, dest);
-}
+#if !defined(ZUECI_EMBED_NO_TO_ECI) && defined(ZUECI_ENCODE_CACHE) && !defined(ZUECI_BMP_TABLES)
+#define ZUECI_USE_ENCODE_CACHE
+
+/* Number of entries (log2) in the per-thread direct-mapped cache of GBK/GB 18030 encodes */
+#ifndef ZUECI_ENCODE_CACHE_BITS
+#define ZUECI_ENCODE_CACHE_BITS 12
 #endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
 
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI 20 Shift JIS to Unicode */
-static int zueci_sjis_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-   /* unsigned char c1, c2;
-    int ind;
-    zueci_u32 u2;
+#if defined(_MSC_VER)
+#  define ZUECI_TLS __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#  define ZUECI_TLS __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#  define ZUECI_TLS _Thread_local
+#else
+#  error "ZUECI_ENCODE_CACHE requires thread-local storage"
+#endif
 
-    assert(len);
-    c1 = src[0];
-    if (c1 < 0x80) {
-        if (c1 == 0x5C) { *//* Backslash to Yen sign *//*
-            *p_u = (flags & ZUECI_FLAG_SJIS_STRAIGHT_THRU) ? c1 : 0xA5;
-        } else if (c1 == 0x7E) { *//* Tilde to overline *//*
-            *p_u = (flags & ZUECI_FLAG_SJIS_STRAIGHT_THRU) ? c1 : 0x203E;
+/* Cache entry - `key` is the codepoint tagged with the ECI (0 if empty), `mb` its multibyte value (4-byters
+   > 0xFFFF), 0 if unmapped */
+typedef struct zueci_cache_entry {
+    zueci_u32 key;
+    zueci_u32 mb;
+} zueci_cache_entry;
+
+static ZUECI_TLS zueci_cache_entry zueci_cache[1 << ZUECI_ENCODE_CACHE_BITS];
+static ZUECI_TLS unsigned long long zueci_cache_hits;
+static ZUECI_TLS unsigned long long zueci_cache_misses;
+
+/* Helper to lookup non-ASCII `u` tagged with `tag` in the cache, converting with `eci_func` and caching on a miss */
+static int zueci_u_cached(const zueci_u32 u, const zueci_u32 tag, int (*eci_func)(const zueci_u32, unsigned char *),
+            unsigned char *dest) {
+    const zueci_u32 key = u | tag;
+    zueci_cache_entry *const entry = zueci_cache + ((key * 0x9E3779B1) >> (32 - ZUECI_ENCODE_CACHE_BITS));
+    zueci_u32 mb;
+
+    if (entry->key == key) {
+        zueci_cache_hits++;
+        mb = entry->mb;
+    } else {
+        unsigned char buf[4];
+        const int len = eci_func(u, buf);
+        zueci_cache_misses++;
+        if (len == 4) {
+            mb = ((zueci_u32) buf[0] << 24) | ((zueci_u32) buf[1] << 16) | ((zueci_u32) buf[2] << 8) | buf[3];
         } else {
-            *p_u = c1;
+            mb = len ? ((zueci_u32) buf[0] << 8) | buf[1] : 0;
         }
-        return 1;
-    }
-    if (c1 >= 0xA1 && c1 <= 0xDF) { *//* Half-width katakana *//*
-        *p_u = 0xFEC0 + c1;
-        return 1;
-    }
-    if (len < 2 || c1 == 0x80 || c1 == 0xA0 || (c1 > 0xEA && c1 < 0xF0) || c1 > 0xF9) {
-        return 0;
+        entry->key = key;
+        entry->mb = mb;
     }
-    c2 = src[1];
-    if (c2 < 0x40 || c2 == 0x7F || c2 > 0xFC) {
+    if (!mb) {
         return 0;
     }
-    if (c1 >= 0xF0 && c1 <= 0xF9) { *//* User-defined to PUA (Table 4-86, Lunde, 2nd ed.) *//*
-        *p_u = 0xE000 + (0xFC - 0x40) * (c1 - 0xF0) + c2 - 0x40 - (c2 > 0x7F);
+    if (mb <= 0xFFFF) {
+        dest[0] = (unsigned char) (mb >> 8);
+        dest[1] = (unsigned char) mb;
         return 2;
     }
-    ind = (0xFC - 0x40) * (c1 - 0x81 - (c1 > 0xA0) * (0xE0 - 0xA0)) + c2 - 0x40 - (c2 > 0x7F);
-    if (ind < ZUECI_ASIZE(zueci_sjis_mb_u) && (u2 = zueci_sjis_mb_u[ind])) {
-        *p_u = u2;
-        return 2;
-    }*/
-    return 0;
-}
-
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_sjis_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_sjis_u(src, len, flags, p_u);
+    dest[0] = (unsigned char) (mb >> 24);
+    dest[1] = (unsigned char) (mb >> 16);
+    dest[2] = (unsigned char) (mb >> 8);
+    dest[3] = (unsigned char) mb;
+    return 4;
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
-
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode to ECI 28 Big5 Chinese (Taiwan) */
-static int zueci_u_big5(const zueci_u32 u, unsigned char *dest) {
-    /*int s, e;
 
+/* As `zueci_u_gbk()` via the cache */
+static int zueci_u_gbk_cache(const zueci_u32 u, unsigned char *dest) {
     if (u < 0x80) {
         *dest = (unsigned char) u;
         return 1;
     }
-    *//* Special case URO block sequential mappings (considerably lessens size of `zueci_big5_u_u[]` array) *//*
-    if (u >= 0x4E00 && u < 0xFA0C) { *//* 0xFA0C next used value >= 0x4E00 *//*
-        if (u >= 0x9FB0) {
-            return 0;
-        }
-        return zueci_u_lookup_uro(u, zueci_big5_uro_u, zueci_big5_uro_mb_ind, zueci_big5_u_mb, dest);
-    }
-    if (u >= zueci_big5_u_u[0] && u <= zueci_big5_u_u[ZUECI_ASIZE(zueci_big5_u_u) - 1]) {
-        s = 0;
-        e = ZUECI_ASIZE(zueci_big5_u_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_big5_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_big5_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_big5_u_mb[u >= 0x4E00 ? m + 13061 : m]; *//* Adjust for URO block *//*
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
-        }
-    }*/
-    return 0;
-}
-
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_big5_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_big5(u, dest);
+    return zueci_u_cached(u, 0x1000000, zueci_u_gbk, dest);
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
-
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI 28 Big5 to Unicode */
-static int zueci_big5_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-/*    unsigned char c1, c2;
-    int ind;
-    zueci_u32 u2;
 
-    (void)flags;
-    assert(len);
-
-    c1 = src[0];
-    if (c1 < 0x80) {
-        *p_u = c1;
+/* As `zueci_u_gb18030()` via the cache */
+static int zueci_u_gb18030_cache(const zueci_u32 u, unsigned char *dest) {
+    if (u < 0x80) {
+        *dest = (unsigned char) u;
         return 1;
     }
-    if (len < 2 || c1 < 0xA1 || c1 == 0xC8 || c1 > 0xF9) {
-        return 0;
-    }
-    c2 = src[1];
-    if (c2 < 0x40 || (c2 > 0x7E && c2 < 0xA1) || c2 == 0xFF) {
-        return 0;
-    }
-    ind = 0x9D * (c1 - 0xA1 - (c1 > 0xC8)) + c2 - 0x40 - (c2 > 0x7E) * (0xA1 - 0x7F);
-    if (ind < ZUECI_ASIZE(zueci_big5_mb_u) && (u2 = zueci_big5_mb_u[ind])) {
-        *p_u = u2;
-        return 2;
-    }*/
-    return 0;
+    return zueci_u_cached(u, 0x2000000, zueci_u_gb18030, dest);
 }
+#endif /* !ZUECI_EMBED_NO_TO_ECI && ZUECI_ENCODE_CACHE && !ZUECI_BMP_TABLES */
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_big5_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_big5_u(src, len, flags, p_u);
-}
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+/* API */
 
 #ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode to ECI 30 EUC-KR (KS X 1001, formerly KS C 5601) Korean */
-static int zueci_u_ksx1001(const zueci_u32 u, unsigned char *dest) {
-    /*int s, e;
-
-    if (u < 0x80) {
-        *dest = (unsigned char) u;
-        return 1;
-    }
-    *//* Special case URO block sequential mappings (considerably lessens size of `zueci_ksx1001_u_u[]` array) *//*
-    if (u >= 0x4E00 && u < 0xAC00) { *//* 0xAC00 next used value >= 0x4E00 *//*
-        if (u >= 0x9FA0) {
-            return 0;
-        }
-        return zueci_u_lookup_uro(u, zueci_ksx1001_uro_u, zueci_ksx1001_uro_mb_ind, zueci_ksx1001_u_mb, dest);
-    }
-    if (u >= zueci_ksx1001_u_u[0] && u <= zueci_ksx1001_u_u[ZUECI_ASIZE(zueci_ksx1001_u_u) - 1]) {
-        s = zueci_ksx1001_u_ind[(u - zueci_ksx1001_u_u[0]) >> 8];
-        e = ZUECI_MIN(s + 0x100, ZUECI_ASIZE(zueci_ksx1001_u_u)) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_ksx1001_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_ksx1001_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_ksx1001_u_mb[u >= 0x4E00 ? m + 4620 : m]; *//* Adjust for URO block *//*
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
-        }
-    }*/
-    return 0;
+/* Define `zueci_utf8_to_eci_<name>()`, the main loop of `zueci_utf8_to_eci()` specialized for Unicode to ECI routine
+   `eci_func`, so that it's called directly (and can be inlined) rather than through a function pointer.
+   If `ascii_direct` set, ASCII maps one-to-one and runs are bulk copied */
+#define ZUECI_UTF8_TO_ECI_LOOP(name, eci_func, ascii_direct) \
+static int zueci_utf8_to_eci_##name(const unsigned char *s, const unsigned char *const se, unsigned char **p_d) { \
+    unsigned char *d = *p_d; \
+    unsigned int state = 0; \
+    zueci_u32 u; \
+    int incr; \
+    while (s < se) { \
+        if ((ascii_direct) && *s < 0x80) { /* Bulk copy ASCII runs, bypassing decoder & `eci_func` */ \
+            const int run = zueci_ascii_copy(s, (int) (se - s), d); \
+            s += run; \
+            d += run; \
+            continue; \
+        } \
+        do { \
+            zueci_decode_utf8(&state, &u, *s++); \
+        } while (s < se && state != 0 && state != 12); \
+        if (state != 0) { \
+            return ZUECI_ERROR_INVALID_UTF8; \
+        } \
+        if (!(incr = eci_func(u, d))) { \
+            return ZUECI_ERROR_INVALID_DATA; \
+        } \
+        d += incr; \
+    } \
+    *p_d = d; \
+    return 0; \
 }
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_ksx1001_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_ksx1001(u, dest);
+ZUECI_UTF8_TO_ECI_LOOP(cp437, zueci_u_cp437, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_2, zueci_u_iso8859_2, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_3, zueci_u_iso8859_3, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_4, zueci_u_iso8859_4, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_5, zueci_u_iso8859_5, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_6, zueci_u_iso8859_6, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_7, zueci_u_iso8859_7, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_8, zueci_u_iso8859_8, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_9, zueci_u_iso8859_9, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_10, zueci_u_iso8859_10, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_11, zueci_u_iso8859_11, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_13, zueci_u_iso8859_13, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_14, zueci_u_iso8859_14, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_15, zueci_u_iso8859_15, 1)
+ZUECI_UTF8_TO_ECI_LOOP(iso8859_16, zueci_u_iso8859_16, 1)
+ZUECI_UTF8_TO_ECI_LOOP(sjis, zueci_u_sjis, 0) /* Backslash & tilde remapped */
+ZUECI_UTF8_TO_ECI_LOOP(cp1250, zueci_u_cp1250, 1)
+ZUECI_UTF8_TO_ECI_LOOP(cp1251, zueci_u_cp1251, 1)
+ZUECI_UTF8_TO_ECI_LOOP(cp1252, zueci_u_cp1252, 1)
+ZUECI_UTF8_TO_ECI_LOOP(cp1256, zueci_u_cp1256, 1)
+ZUECI_UTF8_TO_ECI_LOOP(utf16be, zueci_u_utf16be, 0)
+ZUECI_UTF8_TO_ECI_LOOP(ascii, zueci_u_ascii, 1)
+ZUECI_UTF8_TO_ECI_LOOP(big5, zueci_u_big5, 1)
+ZUECI_UTF8_TO_ECI_LOOP(ksx1001, zueci_u_ksx1001, 1)
+#ifdef ZUECI_BMP_TABLES
+ZUECI_UTF8_TO_ECI_LOOP(gb2312_bmp, zueci_u_gb2312_bmp, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gbk_bmp, zueci_u_gbk_bmp, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gb18030_bmp, zueci_u_gb18030_bmp, 1)
+static int zueci_utf8_to_eci_gb2312(const unsigned char *s, const unsigned char *const se, unsigned char **p_d) {
+    zueci_gb_bmp_init();
+    return zueci_utf8_to_eci_gb2312_bmp(s, se, p_d);
+}
+static int zueci_utf8_to_eci_gbk(const unsigned char *s, const unsigned char *const se, unsigned char **p_d) {
+    zueci_gb_bmp_init();
+    return zueci_utf8_to_eci_gbk_bmp(s, se, p_d);
+}
+static int zueci_utf8_to_eci_gb18030(const unsigned char *s, const unsigned char *const se, unsigned char **p_d) {
+    zueci_gb_bmp_init();
+    return zueci_utf8_to_eci_gb18030_bmp(s, se, p_d);
 }
+#elif defined(ZUECI_USE_ENCODE_CACHE)
+ZUECI_UTF8_TO_ECI_LOOP(gb2312, zueci_u_gb2312, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gbk, zueci_u_gbk_cache, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gb18030, zueci_u_gb18030_cache, 1)
+#else
+ZUECI_UTF8_TO_ECI_LOOP(gb2312, zueci_u_gb2312, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gbk, zueci_u_gbk, 1)
+ZUECI_UTF8_TO_ECI_LOOP(gb18030, zueci_u_gb18030, 1)
 #endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
-
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI 30 EUC-KR to Unicode */
-static int zueci_ksx1001_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-/*    unsigned char c1, c2;
-    int ind;
-    zueci_u32 u2;
-
-    (void)flags;
-    assert(len);
+ZUECI_UTF8_TO_ECI_LOOP(utf16le, zueci_u_utf16le, 0)
+ZUECI_UTF8_TO_ECI_LOOP(utf32be, zueci_u_utf32be, 0)
+ZUECI_UTF8_TO_ECI_LOOP(utf32le, zueci_u_utf32le, 0)
+ZUECI_UTF8_TO_ECI_LOOP(ascii_inv, zueci_u_ascii_inv, 0) /* Some ASCII excluded */
+ZUECI_UTF8_TO_ECI_LOOP(binary, zueci_u_binary, 1)
+
+/* Main body of `zueci_utf8_to_eci()`, args already checked */
+static int zueci_utf8_to_eci_core(const int eci, const unsigned char src[], const int src_len, unsigned char dest[],
+            int *p_dest_len) {
+    unsigned int state = 0;
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    unsigned char *d = dest;
+    zueci_u32 u;
+    int ret;
 
-    c1 = src[0];
-    if (c1 < 0x80) {
-        *p_u = c1;
-        return 1;
-    }
-    if (len < 2 || c1 < 0xA1 || (c1 > 0xAC && c1 < 0xB0) || c1 == 0xC9 || c1 > 0xFD) {
+    /* Special case ISO/IEC 8859-1 */
+    if (eci == 1 || eci == 3) {
+        while (s < se) {
+            if (*s < 0x80) { /* Bulk copy ASCII runs */
+                const int run = zueci_ascii_copy(s, (int) (se - s), d);
+                s += run;
+                d += run;
+                continue;
+            }
+            do {
+                zueci_decode_utf8(&state, &u, *s++);
+            } while (s < se && state != 0 && state != 12);
+            if (state != 0) {
+                return ZUECI_ERROR_INVALID_UTF8;
+            }
+            if (u >= 0x80 && (u < 0xA0 || u >= 0x100)) {
+                return ZUECI_ERROR_INVALID_DATA;
+            }
+            *d++ = (unsigned char) u;
+        }
+        *p_dest_len = (int) (d - dest);
         return 0;
     }
-    c2 = src[1];
-    if (c2 < 0xA1 || c2 == 0xFF) {
+
+    /* Special case UTF-8 */
+    if (eci == 26) {
+        if (!zueci_utf8_copy_valid(src, src_len, dest)) {
+            return ZUECI_ERROR_INVALID_UTF8;
+        }
+        *p_dest_len = src_len;
         return 0;
     }
-    ind = (0xFF - 0xA1) * (c1 - 0xA1 - (c1 > 0xAC) * 3 - (c1 > 0xC9)) + c2 - 0xA1;
-    assert(ind < ZUECI_ASIZE(zueci_ksx1001_mb_u));
-    if ((u2 = zueci_ksx1001_mb_u[ind])) {
-        *p_u = u2;
-        return 2;
-    }*/
-    return 0;
-}
-
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_ksx1001_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_ksx1001_u(src, len, flags, p_u);
-}
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
-
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode to ECI 29 GB 2312 Chinese (PRC) */
-static int zueci_u_gb2312(const zueci_u32 u, unsigned char *dest) {
 
-    if (u < 0x80) {
-        dest[0] = u;
-        return 1;
-    }
-    /* Special case URO block sequential mappings (considerably lessens size of `zueci_gb2312_u_u[]` array) */
-    if (u >= 0x4E00 && u < 0x9E1F) { /* 0x9E1F next used non-sequential value >= 0x4E00 */
-        if (u >= 0x9CF0) {
-            return 0;
-        }
-        return zueci_u_lookup_uro(u, zueci_gb2312_uro_u, zueci_gb2312_uro_mb_ind, zueci_gb2312_u_mb, dest);
-    }
-    if (u >= zueci_gb2312_u_u[0] && u <= zueci_gb2312_u_u[ZUECI_ASIZE(zueci_gb2312_u_u) - 1]) {
-        int s = zueci_gb2312_u_ind[(u - zueci_gb2312_u_u[0]) >> 8];
-        int e = ZUECI_MIN(s + 0x100, ZUECI_ASIZE(zueci_gb2312_u_u)) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_gb2312_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_gb2312_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_gb2312_u_mb[u > 0x4E00 ? m + 6627 : m]; /* Adjust for URO block */
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
-        }
+    /* Dispatch once to the specialized loop */
+    switch (eci) {
+        case 0: case 2: ret = zueci_utf8_to_eci_cp437(s, se, &d); break;
+        case 4: ret = zueci_utf8_to_eci_iso8859_2(s, se, &d); break;
+        case 5: ret = zueci_utf8_to_eci_iso8859_3(s, se, &d); break;
+        case 6: ret = zueci_utf8_to_eci_iso8859_4(s, se, &d); break;
+        case 7: ret = zueci_utf8_to_eci_iso8859_5(s, se, &d); break;
+        case 8: ret = zueci_utf8_to_eci_iso8859_6(s, se, &d); break;
+        case 9: ret = zueci_utf8_to_eci_iso8859_7(s, se, &d); break;
+        case 10: ret = zueci_utf8_to_eci_iso8859_8(s, se, &d); break;
+        case 11: ret = zueci_utf8_to_eci_iso8859_9(s, se, &d); break;
+        case 12: ret = zueci_utf8_to_eci_iso8859_10(s, se, &d); break;
+        case 13: ret = zueci_utf8_to_eci_iso8859_11(s, se, &d); break;
+        case 15: ret = zueci_utf8_to_eci_iso8859_13(s, se, &d); break;
+        case 16: ret = zueci_utf8_to_eci_iso8859_14(s, se, &d); break;
+        case 17: ret = zueci_utf8_to_eci_iso8859_15(s, se, &d); break;
+        case 18: ret = zueci_utf8_to_eci_iso8859_16(s, se, &d); break;
+        case 20: ret = zueci_utf8_to_eci_sjis(s, se, &d); break;
+        case 21: ret = zueci_utf8_to_eci_cp1250(s, se, &d); break;
+        case 22: ret = zueci_utf8_to_eci_cp1251(s, se, &d); break;
+        case 23: ret = zueci_utf8_to_eci_cp1252(s, se, &d); break;
+        case 24: ret = zueci_utf8_to_eci_cp1256(s, se, &d); break;
+        case 25: ret = zueci_utf8_to_eci_utf16be(s, se, &d); break;
+        case 27: ret = zueci_utf8_to_eci_ascii(s, se, &d); break;
+        case 28: ret = zueci_utf8_to_eci_big5(s, se, &d); break;
+        case 29: ret = zueci_utf8_to_eci_gb2312(s, se, &d); break;
+        case 30: ret = zueci_utf8_to_eci_ksx1001(s, se, &d); break;
+        case 31: ret = zueci_utf8_to_eci_gbk(s, se, &d); break;
+        case 32: ret = zueci_utf8_to_eci_gb18030(s, se, &d); break;
+        case 33: ret = zueci_utf8_to_eci_utf16le(s, se, &d); break;
+        case 34: ret = zueci_utf8_to_eci_utf32be(s, se, &d); break;
+        case 35: ret = zueci_utf8_to_eci_utf32le(s, se, &d); break;
+        case 170: ret = zueci_utf8_to_eci_ascii_inv(s, se, &d); break; /* ASCII Invariant (archaic subset) */
+        default: assert(eci == 899); ret = zueci_utf8_to_eci_binary(s, se, &d); break;
+    }
+    if (ret) {
+        return ret;
     }
-    return 0;
-}
+    *p_dest_len = (int) (d - dest);
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_gb2312_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_gb2312(u, dest);
+    return 0;
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
 
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI 29 GB 2312 to Unicode */
-static int zueci_gb2312_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-    unsigned char c1, c2;
-    int ind;
-    zueci_u32 u2;
-
-    (void)flags;
-    assert(len);
-
-    c1 = src[0];
-    if (c1 < 0x80) {
-        *p_u = c1;
-        return 1;
-    }
-    if (len < 2 || c1 < 0xA1 || (c1 > 0xA9 && c1 < 0xB0) || c1 > 0xF7) {
-        return 0;
-    }
-    c2 = src[1];
-    if (c2 < 0xA1 || c2 == 0xFF) {
-        return 0;
+/*
+    Convert UTF-8 `src` of length `src_len` to `eci`-encoded `dest`.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci(const int eci, const unsigned char src[], const int src_len,
+                    unsigned char dest[], int *p_dest_len) {
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
     }
-    ind = (0xFF - 0xA1) * (c1 - 0xA1 - (c1 > 0xA9) * (0xB0 - 0xAA)) + c2 - 0xA1;
-    assert(ind < ZUECI_ASIZE(zueci_gb2312_mb_u));
-    if ((u2 = zueci_gb2312_mb_u[ind])) {
-        *p_u = u2;
-        return 2;
+    if (!src || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
-    return 0;
-}
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_gb2312_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_gb2312_u(src, len, flags, p_u);
+    return zueci_utf8_to_eci_core(eci, src, src_len, dest, p_dest_len);
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode to ECI 31 GBK Chinese */
-static int zueci_u_gbk(const zueci_u32 u, unsigned char *dest) {
-    if (u < 0x80) {
-        *dest = (unsigned char) u;
-        return 1;
-    }
+/*
+    Convert `count` UTF-8 strings `srcs` of lengths `src_lens` to `eci`-encoded `dest`, placing each at
+    `dest_offsets` with per-item statuses in `rets`.
+    Returns the highest of `rets`, or one of `ZUECI_ERROR_XXX` if args invalid.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_batch(const int eci, const unsigned char *const srcs[], const int src_lens[],
+                    const int count, unsigned char dest[], int dest_offsets[], int rets[]) {
+    int d = 0;
+    int ret_max = 0;
+    int i;
 
-    /* Check GB 2312 first */
-    if (u == 0x30FB) {
-        /* KATAKANA MIDDLE DOT, mapped by GB 2312 but not by GBK (U+00B7 MIDDLE DOT mapped to 0xA1A4 instead) */
-        return 0;
-    }
-    if (u == 0x2015) {
-        /* HORIZONTAL BAR, mapped to 0xA844 by GBK rather than 0xA1AA (U+2014 EM DASH mapped there instead) */
-        dest[0] = 0xA8;
-        dest[1] = 0x44;
-        return 2;
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
     }
-    if (zueci_u_gb2312(u, dest)) { /* Includes the 2 GB 6345.1-86 corrections given in Table 3-22, Lunde, 2nd ed. */
-        return 2;
+    if (!srcs || !src_lens || count < 0 || !dest || !dest_offsets || !rets) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
 
-    /* Special case URO block sequential mappings (considerably lessens size of `zueci_gbk_u_u[]` array) */
-    if (u >= 0x4E00 && u < 0xF92C) { /* 0xF92C next used value >= 0x4E00 */
-        if (u >= 0x9FB0) {
-            return 0;
+    for (i = 0; i < count; i++) {
+        int len = 0;
+        dest_offsets[i] = d;
+        if (!srcs[i] || src_lens[i] < 0) {
+            rets[i] = ZUECI_ERROR_INVALID_ARGS;
+        } else if ((rets[i] = zueci_utf8_to_eci_core(eci, srcs[i], src_lens[i], dest + d, &len)) < ZUECI_ERROR) {
+            d += len;
         }
-        return zueci_u_lookup_uro(u, zueci_gbk_uro_u, zueci_gbk_uro_mb_ind, zueci_gbk_u_mb, dest);
-    }
-    if (u >= zueci_gbk_u_u[0] && u <= zueci_gbk_u_u[ZUECI_ASIZE(zueci_gbk_u_u) - 1]) {
-        int s = 0;
-        int e = ZUECI_ASIZE(zueci_gbk_u_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_gbk_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_gbk_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_gbk_u_mb[u >= 0x4E00 ? m + 14139 : m]; /* Adjust for URO block */
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
-            }
+        if (rets[i] > ret_max) {
+            ret_max = rets[i];
         }
     }
-    return 0;
-}
+    dest_offsets[count] = d;
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_gbk_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_gbk(u, dest);
+    return ret_max;
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
 
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI 31 GBK Chinese to Unicode */
-static int zueci_gbk_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-    unsigned char c1, c2;
-    int ind;
-    zueci_u32 u2;
-    zueci_u16 mb;
+/* ECIs that can encode all of Unicode */
+#define ZUECI_MASK_UNICODE      (ZUECI_ECI_BIT(25) | ZUECI_ECI_BIT(26) | ZUECI_ECI_BIT(32) | ZUECI_ECI_BIT(33) \
+                                    | ZUECI_ECI_BIT(34) | ZUECI_ECI_BIT(35))
+/* All valid ECIs */
+#define ZUECI_MASK_ALL          (((ZUECI_ECI_BIT(36) - 1 - ZUECI_ECI_BIT(14) - ZUECI_ECI_BIT(19)) \
+                                    | ZUECI_ECI_BIT(170) | ZUECI_ECI_BIT(899)) & ZUECI_ECIS_BUILT)
+/* ECIs limited to U+0000-00FF */
+#define ZUECI_MASK_LATIN1       (ZUECI_ECI_BIT(1) | ZUECI_ECI_BIT(3) | ZUECI_ECI_BIT(27) | ZUECI_ECI_BIT(170) \
+                                    | ZUECI_ECI_BIT(899))
+/* Single-byte ECIs, which can't encode anything above U+25A0 (BLACK SQUARE in IBM CP437, the highest codepoint in
+   their tables) */
+#define ZUECI_MASK_SB           ((ZUECI_ECI_BIT(19) - 1 - ZUECI_ECI_BIT(14)) | ZUECI_ECI_BIT(21) | ZUECI_ECI_BIT(22) \
+                                    | ZUECI_ECI_BIT(23) | ZUECI_ECI_BIT(24) | ZUECI_MASK_LATIN1)
+#define ZUECI_SB_MAX_U          0x25A0
+/* ECIs that don't encode all of ASCII as is (so their loops don't copy it directly) */
+#define ZUECI_MASK_ASCII_CHECK  (ZUECI_ECI_BIT(20) | ZUECI_ECI_BIT(170))
+
+/* ECIs indexed by bit in mask */
+static const short zueci_mask_ecis[38] = {
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 170, 899
+};
 
-    (void)flags;
-    assert(len);
+/* Index of lowest set bit of non-zero `mask` */
+static int zueci_lowest_bit(const unsigned long long mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    int i = 0;
+    unsigned long long m = mask;
+    while (!(m & 1)) {
+        m >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
 
-    c1 = src[0];
-    if (c1 < 0x80) {
-        *p_u = c1;
-        return 1;
+/* Convert Unicode codepoint `u` to `eci`-encoded `dest` (at least 4 bytes), returning length, or 0 if no mapping -
+   non-loop version of the routines dispatched to by `zueci_utf8_to_eci_core()` (UTF-8 length only) */
+static int zueci_u_eci(const int eci, const zueci_u32 u, unsigned char *dest) {
+    switch (eci) {
+        case 0: case 2: return zueci_u_cp437(u, dest);
+        case 1: case 3: *dest = (unsigned char) u; return u < 0x80 || (u >= 0xA0 && u < 0x100);
+        case 4: return zueci_u_iso8859_2(u, dest);
+        case 5: return zueci_u_iso8859_3(u, dest);
+        case 6: return zueci_u_iso8859_4(u, dest);
+        case 7: return zueci_u_iso8859_5(u, dest);
+        case 8: return zueci_u_iso8859_6(u, dest);
+        case 9: return zueci_u_iso8859_7(u, dest);
+        case 10: return zueci_u_iso8859_8(u, dest);
+        case 11: return zueci_u_iso8859_9(u, dest);
+        case 12: return zueci_u_iso8859_10(u, dest);
+        case 13: return zueci_u_iso8859_11(u, dest);
+        case 15: return zueci_u_iso8859_13(u, dest);
+        case 16: return zueci_u_iso8859_14(u, dest);
+        case 17: return zueci_u_iso8859_15(u, dest);
+        case 18: return zueci_u_iso8859_16(u, dest);
+        case 20: return zueci_u_sjis(u, dest);
+        case 21: return zueci_u_cp1250(u, dest);
+        case 22: return zueci_u_cp1251(u, dest);
+        case 23: return zueci_u_cp1252(u, dest);
+        case 24: return zueci_u_cp1256(u, dest);
+        case 25: return zueci_u_utf16be(u, dest);
+        case 26: return 1 + (u >= 0x80) + (u >= 0x800) + (u >= 0x10000);
+        case 27: return zueci_u_ascii(u, dest);
+        case 28: return zueci_u_big5(u, dest);
+#ifdef ZUECI_BMP_TABLES
+        case 29: zueci_gb_bmp_init(); return zueci_u_gb2312_bmp(u, dest);
+        case 30: return zueci_u_ksx1001(u, dest);
+        case 31: zueci_gb_bmp_init(); return zueci_u_gbk_bmp(u, dest);
+        case 32: zueci_gb_bmp_init(); return zueci_u_gb18030_bmp(u, dest);
+#elif defined(ZUECI_USE_ENCODE_CACHE)
+        case 29: return zueci_u_gb2312(u, dest);
+        case 30: return zueci_u_ksx1001(u, dest);
+        case 31: return zueci_u_gbk_cache(u, dest);
+        case 32: return zueci_u_gb18030_cache(u, dest);
+#else
+        case 29: return zueci_u_gb2312(u, dest);
+        case 30: return zueci_u_ksx1001(u, dest);
+        case 31: return zueci_u_gbk(u, dest);
+        case 32: return zueci_u_gb18030(u, dest);
+#endif
+        case 33: return zueci_u_utf16le(u, dest);
+        case 34: return zueci_u_utf32be(u, dest);
+        case 35: return zueci_u_utf32le(u, dest);
+        case 170: return zueci_u_ascii_inv(u, dest);
     }
-    if (len < 2 || c1 < 0x81 || c1 == 0xFF) {
-        return 0;
+    assert(eci == 899);
+    return zueci_u_binary(u, dest);
+}
+
+/* Mask of ECIs that can't possibly encode non-ASCII codepoint `u` */
+static unsigned long long zueci_u_unmappable(const zueci_u32 u) {
+    if (u >= 0x100) {
+        return u > ZUECI_SB_MAX_U ? ZUECI_MASK_SB : ZUECI_MASK_LATIN1;
     }
-    c2 = src[1];
-    if (c2 < 0x40 || c2 == 0x7F || c2 == 0xFF) {
-        return 0;
+    if (u < 0xA0) {
+        return ZUECI_ECI_BIT(1) | ZUECI_ECI_BIT(3) | ZUECI_ECI_BIT(27) | ZUECI_ECI_BIT(170);
     }
+    return ZUECI_ECI_BIT(27) | ZUECI_ECI_BIT(170);
+}
 
-    /* Try GB 2312 first */
-    if (((c1 >= 0xA1 && c1 <= 0xA9) || (c1 >= 0xB0 && c1 <= 0xF7)) && c2 >= 0xA1) {
-        if (c1 == 0xA1 && c2 == 0xA4) {
-            *p_u = 0x00B7; /* MIDDLE DOT */
-            return 2;
-        }
-        if (c1 == 0xA1 && c2 == 0xAA) {
-            *p_u = 0x2014; /* EM DASH */
-            return 2;
-        }
-        if (zueci_gb2312_u(src, len, 0 /*flags*/, p_u)) {
-            return 2;
-        }
+/*
+    Set `p_eci_mask` to the ECIs that UTF-8 `src` of length `src_len` can be converted to, decoding it once only.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_eci_mask(const unsigned char src[], const int src_len, unsigned long long *p_eci_mask) {
+    unsigned long long mask = ZUECI_MASK_ALL;
+    unsigned int state = 0;
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    unsigned char buf[4];
+    zueci_u32 u;
+
+    if (!src || src_len < 0 || !p_eci_mask) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
 
-    /* Non-URO? */
-    mb = ((zueci_u16) c1 << 8) | c2;
-    if (mb >= zueci_gbk_nonuro_mb[0] && mb <= zueci_gbk_nonuro_mb[ZUECI_ASIZE(zueci_gbk_nonuro_mb) - 1]) {
-        int s = 0;
-        int e = ZUECI_ASIZE(zueci_gbk_nonuro_mb) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_gbk_nonuro_mb[m] < mb) {
-                s = m + 1;
-            } else if (zueci_gbk_nonuro_mb[m] > mb) {
-                e = m - 1;
-            } else {
-                *p_u = zueci_gbk_nonuro_u[m];
-                return 2;
+    while (s < se) {
+        unsigned long long check;
+        if (*s < 0x80) {
+            /* Skip ASCII runs once all ECIs left encode it as is (and everything once only Unicode ECIs left) */
+            if (!(mask & ZUECI_MASK_ASCII_CHECK)) {
+                s += zueci_ascii_len(s, (int) (se - s));
+                continue;
+            }
+            if ((mask & ZUECI_ECI_BIT(20)) && !zueci_u_sjis(*s, buf)) {
+                mask &= ~ZUECI_ECI_BIT(20);
+            }
+            if ((mask & ZUECI_ECI_BIT(170)) && !zueci_u_ascii_inv(*s, buf)) {
+                mask &= ~ZUECI_ECI_BIT(170);
+            }
+            s++;
+            continue;
+        }
+        do {
+            zueci_decode_utf8(&state, &u, *s++);
+        } while (s < se && state != 0 && state != 12);
+        if (state != 0) {
+            return ZUECI_ERROR_INVALID_UTF8;
+        }
+        mask &= ~zueci_u_unmappable(u); /* Clear those that can't possibly encode `u` first */
+        for (check = mask & ~ZUECI_MASK_UNICODE; check; check &= check - 1) {
+            const int eci = zueci_mask_ecis[zueci_lowest_bit(check)];
+            if (!zueci_u_eci(eci, u, buf)) {
+                mask &= ~ZUECI_ECI_BIT(eci);
             }
         }
     }
 
-    if (c1 >= 0xA1 && (c1 <= 0xA7 || (c1 >= 0xA8 && c2 >= 0xA1))) {
-        return 0;
-    }
-    if (c1 >= 0xA8) {
-        ind = (0xFF - 0x40 - 1) * (0xA1 - 0x81) + (0xA1 - 0x40 - 1) * (c1 - 0xA8) + c2 - 0x40 - (c2 > 0x7F);
-    } else {
-        ind = (0xFF - 0x40 - 1) * (c1 - 0x81) + c2 - 0x40 - (c2 > 0x7F);
-    }
-    if (ind < ZUECI_ASIZE(zueci_gbk_mb_u) && (u2 = zueci_gbk_mb_u[ind])) {
-        *p_u = u2;
-        return 2;
-    }
+    *p_eci_mask = mask;
+
     return 0;
 }
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_gbk_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_gbk_u(src, len, flags, p_u);
-}
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+/* Set `incrs` (indexed by bit) to the lengths `u` converts to for each ECI in `mask`, returning `mask` less those
+   that can't convert it */
+static unsigned long long zueci_u_eci_lens(const zueci_u32 u, unsigned long long mask, int incrs[38]) {
+    unsigned long long check;
+    unsigned char buf[4];
+    int gb_incr = 0;
 
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Helper for `u_gb18030()` to output 4-byte sequential blocks 0x[81-FE][30-39][81-FE][30-39] */
-static int zueci_u_gb18030_4_sequential(zueci_u32 u2, zueci_u32 mb_lead, unsigned char *dest) {
-    zueci_u32 dv;
-
-    dv = u2 / 10; /* (0x39 - 0x30) + 1 */
-    dest[3] = (unsigned char) (u2 - dv * 10 + 0x30);
-    u2 = dv;
-    dv = u2 / 126; /* (0xFE - 0x81) + 1 */
-    dest[2] = (unsigned char) (u2 - dv * 126 + 0x81);
-    u2 = dv;
-    dv = u2 / 10; /* (0x39 - 0x30) + 1 */
-    dest[0] = (unsigned char) (dv + mb_lead);
-    dest[1] = (unsigned char) (u2 - dv * 10 + 0x30);
-    return 4;
-}
+    if (u >= 0x80) {
+        mask &= ~zueci_u_unmappable(u);
+    }
+    for (check = mask; check; check &= check - 1) {
+        const int bit = zueci_lowest_bit(check);
+        const int eci = zueci_mask_ecis[bit];
+        int incr;
+        /* GBK checks GB 2312 first (bar U+30FB) and GB 18030 checks GBK first, so a mapping by one is a mapping
+           of the same length by those after it (bits visited in ECI order) */
+        if (u < 0x80 && !(ZUECI_ECI_BIT(eci) & ZUECI_MASK_ASCII_CHECK)) {
+            incr = eci == 34 || eci == 35 ? 4 : eci == 25 || eci == 33 ? 2 : 1;
+        } else if (gb_incr && (eci == 31 || eci == 32)) {
+            incr = gb_incr;
+        } else if (!(incr = zueci_u_eci(eci, u, buf))) {
+            mask &= ~ZUECI_ECI_BIT(eci);
+        } else if ((eci == 29 && u != 0x30FB) || eci == 31) {
+            gb_incr = incr;
+        }
+        incrs[bit] = incr;
+    }
 
-/* Unicode to ECI 32 GB 18030 Chinese - assumes valid Unicode */
-static int zueci_u_gb18030(const zueci_u32 u, unsigned char *dest) {
-    zueci_u32 u2, dv;
-    int s, e;
+    return mask;
+}
 
-    if (u < 0x80) {
-        *dest = (unsigned char) u;
-        return 1;
-    }
+/*
+    Set `p_eci` to the ECI of `ecis` that UTF-8 `src` of length `src_len` converts to in the fewest bytes, and
+    `p_dest_len` to that number, decoding `src` once only.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_best_eci(const unsigned char src[], const int src_len, const int ecis[], const int ecis_len,
+                    int *p_eci, int *p_dest_len) {
+    int lens[38] = {0}; /* Indexed by bit */
+    unsigned long long mask = 0;
+    unsigned int state = 0;
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    unsigned char buf[4];
+    int incrs[38];
+    zueci_u32 u;
+    int best_eci = -1, best_len = 0;
+    int i;
 
-    /* Check GBK first */
-    if (zueci_u_gbk(u, dest)) {
-        return 2;
+    if (!src || src_len < 0 || !ecis || ecis_len <= 0 || !p_eci || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
-
-    if (u >= 0x10000) {
-        /* Non-BMP that were PUA, see Table 3-37, Lunde, 2nd ed. */
-        if (u == 0x20087) {
-            dest[0] = 0xFE;
-            dest[1] = 0x51;
-            return 2;
-        }
-        if (u == 0x20089) {
-            dest[0] = 0xFE;
-            dest[1] = 0x52;
-            return 2;
-        }
-        if (u == 0x200CC) {
-            dest[0] = 0xFE;
-            dest[1] = 0x53;
-            return 2;
-        }
-        if (u == 0x215D7) {
-            dest[0] = 0xFE;
-            dest[1] = 0x6C;
-            return 2;
-        }
-        if (u == 0x2298F) {
-            dest[0] = 0xFE;
-            dest[1] = 0x76;
-            return 2;
-        }
-        if (u == 0x241FE) {
-            dest[0] = 0xFE;
-            dest[1] = 0x91;
-            return 2;
-        }
-        /* All other non-BMP U+10000-10FFFF */
-        return zueci_u_gb18030_4_sequential(u - 0x10000, 0x90, dest);
-    }
-    if (u >= 0xE000 && u <= 0xE765) { /* PUA to user-defined */
-        if (u <= 0xE4C5) {
-            u2 = u - 0xE000;
-            dv = u2 / 94;
-            dest[0] = (unsigned char) (dv + (dv < 6 ? 0xAA : 0xF2));
-            dest[1] = (unsigned char) (u2 - dv * 94 + 0xA1);
-        } else {
-            zueci_u32 md;
-            u2 = u - 0xE4C6;
-            dv = u2 / 96;
-            md = u2 - dv * 96;
-            dest[0] = (unsigned char) (dv + 0xA1);
-            dest[1] = (unsigned char) (md + 0x40 + (md >= 0x3F));
+    for (i = 0; i < ecis_len; i++) {
+        if (!zueci_is_valid_eci(ecis[i])) {
+            return ZUECI_ERROR_INVALID_ECI;
         }
-        return 2;
+        mask |= ZUECI_ECI_BIT(ecis[i]);
     }
-    if (u >= zueci_gb18030_2_u_u[0] && u <= zueci_gb18030_2_u_u[ZUECI_ASIZE(zueci_gb18030_2_u_u) - 1]) {
-        int s = 0;
-        int e = ZUECI_ASIZE(zueci_gb18030_2_u_u) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_gb18030_2_u_u[m] < u) {
-                s = m + 1;
-            } else if (zueci_gb18030_2_u_u[m] > u) {
-                e = m - 1;
-            } else {
-                const zueci_u16 mb = zueci_gb18030_2_u_mb[m];
-                dest[0] = (unsigned char) (mb >> 8);
-                dest[1] = (unsigned char) mb;
-                return 2;
+
+    while (s < se) {
+        unsigned long long check;
+        if (*s < 0x80) {
+            /* Whole ASCII runs, except for those that don't encode it all as is */
+            const int run = zueci_ascii_len(s, (int) (se - s));
+            for (check = mask; check; check &= check - 1) {
+                const int bit = zueci_lowest_bit(check);
+                const int eci = zueci_mask_ecis[bit];
+                if (ZUECI_ECI_BIT(eci) & ZUECI_MASK_ASCII_CHECK) {
+                    int j, incr = 1;
+                    for (j = 0; j < run && (incr = zueci_u_eci(eci, s[j], buf)); j++) {
+                        lens[bit] += incr;
+                    }
+                    if (!incr) {
+                        mask &= ~ZUECI_ECI_BIT(eci);
+                    }
+                } else {
+                    lens[bit] += run * (eci == 34 || eci == 35 ? 4 : eci == 25 || eci == 33 ? 2 : 1);
+                }
             }
+            s += run;
+            continue;
         }
-    }
-    /* All other BMP U+0080-FFFF */
-    if (u == 0xE7C7) { /* PUA change to non-PUA, see Table 3-39, Lunde, 2nd ed. */
-        dest[0] = 0x81;
-        dest[1] = 0x35;
-        dest[2] = 0xF4;
-        dest[3] = 0x37;
-        return 4;
-    }
-    s = 0;
-    e = ZUECI_ASIZE(zueci_gb18030_4_u_e) - 1;
-    while (s < e) { /* Lower bound */
-        const int m = (s + e) >> 1;
-        if (zueci_gb18030_4_u_e[m] < u) {
-            s = m + 1;
-        } else {
-            e = m;
+        do {
+            zueci_decode_utf8(&state, &u, *s++);
+        } while (s < se && state != 0 && state != 12);
+        if (state != 0) {
+            return ZUECI_ERROR_INVALID_UTF8;
+        }
+        mask = zueci_u_eci_lens(u, mask, incrs);
+        for (check = mask; check; check &= check - 1) {
+            const int bit = zueci_lowest_bit(check);
+            lens[bit] += incrs[bit];
         }
     }
-    assert(s < ZUECI_ASIZE(zueci_gb18030_4_u_e));
-    return zueci_u_gb18030_4_sequential(u - zueci_gb18030_4_u_mb_o[s] - 0x80, 0x81, dest);
-}
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_u_gb18030_test(const zueci_u32 u, unsigned char *dest) {
-    return zueci_u_gb18030(u, dest);
-}
-#endif
-#endif /* ZUECI_EMBED_NO_TO_ECI */
+    /* Earliest in `ecis` wins ties */
+    for (i = 0; i < ecis_len; i++) {
+        const int bit = zueci_lowest_bit(ZUECI_ECI_BIT(ecis[i]));
+        if ((mask & ZUECI_ECI_BIT(ecis[i])) && (best_eci == -1 || lens[bit] < best_len)) {
+            best_eci = ecis[i];
+            best_len = lens[bit];
+        }
+    }
+    if (best_eci == -1) {
+        return ZUECI_ERROR_INVALID_DATA;
+    }
 
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* Helper to convert GB 18030 4-byter to Unicode */
-static zueci_u32 zueci_gb18030_mb4_u(zueci_u32 mb4) {
-    unsigned char c1 = (unsigned char) (mb4 >> 24);
-    unsigned char c2 = (unsigned char) (mb4 >> 16);
-    unsigned char c3 = (unsigned char) (mb4 >> 8);
-    unsigned char c4 = (unsigned char) mb4;
+    *p_eci = best_eci;
+    *p_dest_len = best_len;
 
-    return (((c1 - 0x81) * 10 + (c2 - 0x30)) * 126 + (c3 - 0x81)) * 10 + c4 - 0x30;
-}
-static int fake(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u){
     return 0;
 }
 
-/* ECI 32 GB 18030 to Unicode */
-static int zueci_gb18030_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags, zueci_u32 *p_u) {
-    unsigned char c1, c2, c3, c4;
-    int ret;
-    zueci_u16 mb2;
-    zueci_u32 mb4;
-
-    (void)flags;
-    assert(len);
+/*
+    Split UTF-8 `src` of length `src_len` into segments of ECIs `ecis` minimizing the total converted length
+    including `switch_cost` per segment, placing them in `segs` and their number in `p_segs_len`, and the total in
+    `p_total_len`. `segs` must have room for an entry per codepoint (`src_len` entries suffices), as it's used as
+    scratch for the back-references, other state being per ECI.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_segment(const unsigned char src[], const int src_len, const int ecis[],
+                    const int ecis_len, const int switch_cost, zueci_segment segs[], int *p_segs_len,
+                    int *p_total_len) {
+    /* Per ECI (indexed by bit) cost and number of segments of the best conversion so far whose last segment is
+       that ECI, with the start of that segment (codepoint index and offset) */
+    int costs[38], nsegs[38], starts[38], offsets[38];
+    int incrs[38];
+    int order[38]; /* Bits in order of `ecis`, without duplicates */
+    int order_len = 0;
+    unsigned long long mask = 0;
+    unsigned int state = 0;
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    zueci_u32 u;
+    int cnt = 0; /* Codepoints so far */
+    int best, prev_cost, prev_nsegs, segs_len;
+    int i;
 
-    c1 = src[0];
-    if (c1 < 0x80) {
-        *p_u = c1;
-        return 1;
+    if (!src || src_len < 0 || !ecis || ecis_len <= 0 || switch_cost < 0 || !segs || !p_segs_len
+            || !p_total_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
-    if (len < 2 || c1 < 0x81 || c1 == 0xFF) {
-        return 0;
+    for (i = 0; i < ecis_len; i++) {
+        if (!zueci_is_valid_eci(ecis[i])) {
+            return ZUECI_ERROR_INVALID_ECI;
+        }
+        if (!(mask & ZUECI_ECI_BIT(ecis[i]))) {
+            mask |= ZUECI_ECI_BIT(ecis[i]);
+            order[order_len++] = zueci_lowest_bit(ZUECI_ECI_BIT(ecis[i]));
+        }
     }
-    if ((ret = zueci_gbk_u(src, len, 0 /*flags*/, p_u))) {
-        return ret;
+    for (i = 0; i < order_len; i++) {
+        costs[order[i]] = switch_cost;
+        nsegs[order[i]] = 1;
+        starts[order[i]] = offsets[order[i]] = 0;
     }
-    c2 = src[1];
-    if (len >= 4 && c2 <= 0x39 && c2 >= 0x30 && c1 >= 0x81 && c1 <= 0xE3) {
-        c3 = src[2];
-        c4 = src[3];
-        mb4 = ZUECI_4BYTES_U32(c1, c2, c3, c4);
-        if (mb4 < 0x81308130 || (mb4 > 0x8431A439 && mb4 < 0x90308130) || mb4 > 0xE3329A35
-                || c3 < 0x81 || c3 > 0xFE || c4 < 0x30 || c4 > 0x39) {
-            return 0;
+    best = order[0];
+
+    /* Each ECI either continues its own segment or starts a new one after the best so far, which is recorded per
+       codepoint in `segs` (as `eci` bit, `offset`, `length` codepoint start and `dest_len` cost) for tracing back */
+    while (s < se) {
+        const int offset = (int) (s - src);
+        unsigned long long todo;
+        int new_best = -1;
+        do {
+            zueci_decode_utf8(&state, &u, *s++);
+        } while (s < se && state != 0 && state != 12);
+        if (state != 0) {
+            return ZUECI_ERROR_INVALID_UTF8;
         }
-        if (mb4 == 0x8135F437) { /* PUA change to non-PUA, see Table 3-39, Lunde, 2nd ed. */
-            *p_u = 0xE7C7;
-            return 4;
+        todo = zueci_u_eci_lens(u, mask, incrs);
+        if (!todo) {
+            return ZUECI_ERROR_INVALID_DATA;
         }
-        if (c1 >= 0x90) { /* Non-BMP */
-            *p_u = 0x10000 + (((c1 - 0x90) * 10 + (c2 - 0x30)) * 126 + (c3 - 0x81)) * 10 + c4 - 0x30;
-        } else { /* BMP */
-            int s = 0;
-            int e = ZUECI_ASIZE(zueci_gb18030_4_mb_e) - 1;
-            while (s < e) { /* Lower bound */
-                const int m = (s + e) >> 1;
-                if (zueci_gb18030_4_mb_e[m] < mb4) {
-                    s = m + 1;
-                } else {
-                    e = m;
-                }
+        prev_cost = costs[best] + switch_cost;
+        prev_nsegs = nsegs[best] + 1;
+        for (i = 0; i < order_len; i++) {
+            const int bit = order[i];
+            if (!(todo & ((unsigned long long) 1 << bit))) {
+                costs[bit] = -1; /* Can't continue */
+                continue;
+            }
+            if (cnt && (costs[bit] == -1 || prev_cost < costs[bit]
+                        || (prev_cost == costs[bit] && prev_nsegs < nsegs[bit]))) {
+                costs[bit] = prev_cost;
+                nsegs[bit] = prev_nsegs;
+                starts[bit] = cnt;
+                offsets[bit] = offset;
+            }
+            costs[bit] += incrs[bit];
+            if (new_best == -1 || costs[bit] < costs[new_best]
+                    || (costs[bit] == costs[new_best] && nsegs[bit] < nsegs[new_best])) {
+                new_best = bit;
             }
-            assert(s < ZUECI_ASIZE(zueci_gb18030_4_mb_e));
-            *p_u = zueci_gb18030_4_u_e[s] - (zueci_gb18030_mb4_u(zueci_gb18030_4_mb_e[s]) - zueci_gb18030_mb4_u(mb4));
         }
-        return 4;
-    }
-    if (c2 < 0x40 || c2 == 0x7F || c2 == 0xFF) {
+        best = new_best;
+        segs[cnt].eci = best;
+        segs[cnt].offset = offsets[best];
+        segs[cnt].length = starts[best];
+        segs[cnt].dest_len = costs[best];
+        cnt++;
+    }
+    if (cnt == 0) {
+        *p_segs_len = *p_total_len = 0;
         return 0;
     }
-    if (((c1 >= 0xAA && c1 <= 0xAF) || (c1 >= 0xF8 && c1 <= 0xFE)) && c2 >= 0xA1 && c2 <= 0xFE) { /* UDA-1/2 PUA */
-        *p_u = 0xE000 + (0xFF - 0xA0 - 1) * (c1 - (c1 >= 0xF8 ? 0xF2 : 0xAA)) + c2 - 0xA1;
-        return 2;
-    }
-    if (c1 >= 0xA1 && c1 <= 0xA7 && c2 <= 0xA1) { /* UDA-3 PUA */
-        *p_u = 0xE4C6 + (0xA1 - 0x40 - 1) * (c1 - 0xA1) + c2 - 0x40 - (c2 > 0x7F);
-        return 2;
-    }
-    if (c1 == 0xFE && c2 >= 0x51 && c2 <= 0x91) {
-        /* Non-BMP that were PUA, see Table 3-37, Lunde, 2nd ed. */
-        if (c2 == 0x51) {
-            *p_u = 0x20087;
-            return 2;
-        }
-        if (c2 == 0x52) {
-            *p_u = 0x20089;
-            return 2;
-        }
-        if (c2 == 0x53) {
-            *p_u = 0x200CC;
-            return 2;
-        }
-        if (c2 == 0x6C) {
-            *p_u = 0x215D7;
-            return 2;
-        }
-        if (c2 == 0x76) {
-            *p_u = 0x2298F;
-            return 2;
-        }
-        if (c2 == 0x91) {
-            *p_u = 0x241FE;
-            return 2;
-        }
-    }
-    mb2 = ((zueci_u16) c1 << 8) | c2;
-    if (mb2 >= zueci_gb18030_2_mb_mb[0] && mb2 <= zueci_gb18030_2_mb_mb[ZUECI_ASIZE(zueci_gb18030_2_mb_mb) - 1]) {
-        int s = 0;
-        int e = ZUECI_ASIZE(zueci_gb18030_2_mb_mb) - 1;
-        while (s <= e) {
-            const int m = (s + e) >> 1;
-            if (zueci_gb18030_2_mb_mb[m] < mb2) {
-                s = m + 1;
-            } else if (zueci_gb18030_2_mb_mb[m] > mb2) {
-                e = m - 1;
-            } else {
-                *p_u = zueci_gb18030_2_mb_u[m];
-                return 2;
+    *p_total_len = costs[best];
+
+    /* Trace back, placing segments at the end of `segs` - the `i`th from last goes at `cnt - i`, above any
+       codepoint entry still to be read (each segment having at least one codepoint) */
+    {
+        int bit = best, start = starts[best], seg_offset = offsets[best], cost = costs[best];
+        int end = src_len;
+        segs_len = 0;
+        for (;;) {
+            prev_cost = start ? segs[start - 1].dest_len : 0;
+            segs_len++;
+            segs[cnt - segs_len].eci = zueci_mask_ecis[bit];
+            segs[cnt - segs_len].offset = seg_offset;
+            segs[cnt - segs_len].length = end - seg_offset;
+            segs[cnt - segs_len].dest_len = cost - prev_cost - switch_cost;
+            if (!start) {
+                break;
             }
+            end = seg_offset;
+            cost = prev_cost;
+            i = start - 1;
+            bit = segs[i].eci;
+            seg_offset = segs[i].offset;
+            start = segs[i].length;
         }
     }
-    return 0;
-}
+    if (segs_len != cnt) {
+        memmove(segs, segs + cnt - segs_len, sizeof(zueci_segment) * segs_len);
+    }
+    *p_segs_len = segs_len;
 
-#ifdef ZUECI_TEST /* Wrapper for direct testing */
-ZUECI_INTERN int zueci_gb18030_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                    zueci_u32 *p_u) {
-    return zueci_gb18030_u(src, len, flags, p_u);
+    return 0;
 }
-#endif
-#endif /* ZUECI_EMBED_NO_TO_UTF8 */
-
-/* API */
 
-#ifndef ZUECI_EMBED_NO_TO_ECI
 /*
-    Convert UTF-8 `src` of length `src_len` to `eci`-encoded `dest`.
-    `p_dest_len` is set to length of `dest` on output.
-    `dest` must be big enough (4-times the `src_len`, or see `zueci_dest_len_eci()`). It is not NUL-terminated.
-    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not
- */
-ZUECI_EXTERN int zueci_utf8_to_eci(const int eci, const unsigned char src[], const int src_len,
-                    unsigned char dest[], int *p_dest_len) {
-    /* Unicode to ECI function table */
-    typedef int (*zueci_eci_func_t)(const zueci_u32 u, unsigned char *dest);
-    static const zueci_eci_func_t zueci_eci_funcs[36] = {
-             zueci_u_cp437,               NULL,      zueci_u_cp437,               NULL,  zueci_u_iso8859_2, /*0-4*/
-         zueci_u_iso8859_3,  zueci_u_iso8859_4,  zueci_u_iso8859_5,  zueci_u_iso8859_6,  zueci_u_iso8859_7, /*5-9*/
-         zueci_u_iso8859_8,  zueci_u_iso8859_9, zueci_u_iso8859_10, zueci_u_iso8859_11,               NULL, /*10-14*/
-        zueci_u_iso8859_13, zueci_u_iso8859_14, zueci_u_iso8859_15, zueci_u_iso8859_16,               NULL, /*15-19*/
-              zueci_u_sjis,     zueci_u_cp1250,     zueci_u_cp1251,     zueci_u_cp1252,     zueci_u_cp1256, /*20-24*/
-           zueci_u_utf16be,               NULL,      zueci_u_ascii,       zueci_u_big5,     zueci_u_gb2312, /*25-29*/
-           zueci_u_ksx1001,        zueci_u_gbk,    zueci_u_gb18030,    zueci_u_utf16le,    zueci_u_utf32be, /*30-34*/
-           zueci_u_utf32le,
-    };
-    unsigned int state = 0;
-    const unsigned char *s = src;
-    const unsigned char *const se = src + src_len;
-    unsigned char *d = dest;
-    zueci_eci_func_t eci_func;
-    zueci_u32 u;
-
-    if (!zueci_is_valid_eci(eci)) {
-        return ZUECI_ERROR_INVALID_ECI;
-    }
-    if (!src || !dest || !p_dest_len) {
-        return ZUECI_ERROR_INVALID_ARGS;
-    }
-
-    /* Special case ISO/IEC 8859-1 */
-    if (eci == 1 || eci == 3) {
-        while (s < se) {
-            do {
-                zueci_decode_utf8(&state, &u, *s++);
-            } while (s < se && state != 0 && state != 12);
-            if (state != 0) {
-                return ZUECI_ERROR_INVALID_UTF8;
-            }
-            if (u >= 0x80 && (u < 0xA0 || u >= 0x100)) {
-                return ZUECI_ERROR_INVALID_DATA;
-            }
-            *d++ = (unsigned char) u;
-        }
-        *p_dest_len = (int) (d - dest);
-        return 0;
-    }
-
-    /* Special case UTF-8 */
-    if (eci == 26) {
-        if (!zueci_is_valid_utf8(src, src_len)) {
-            return ZUECI_ERROR_INVALID_UTF8;
-        }
-        memcpy(dest, src, src_len);
-        *p_dest_len = src_len;
-        return 0;
-    }
-
-    if (eci == 170) { /* ASCII Invariant (archaic subset) */
-        eci_func = zueci_u_ascii_inv;
-    } else if (eci == 899) { /* Binary */
-        eci_func = zueci_u_binary;
-    } else {
-        eci_func = zueci_eci_funcs[eci];
-    }
-
-    while (s < se) {
-        int incr;
-        do {
-            zueci_decode_utf8(&state, &u, *s++);
-        } while (s < se && state != 0 && state != 12);
-        if (state != 0) {
-            return ZUECI_ERROR_INVALID_UTF8;
-        }
-        incr = (*eci_func)(u, d);
-        if (incr == 0) {
-            return ZUECI_ERROR_INVALID_DATA;
-        }
-        d += incr;
-    }
-    *p_dest_len = (int) (d - dest);
-
-    return 0;
-}
-
-/*
-    Calculate sufficient (i.e. approx.) length needed to convert UTF-8 `src` of length `src_len` from UTF-8 to ECI
-    `eci`, and place in `p_dest_len`.
+    Calculate sufficient (i.e. approx.) length needed to convert UTF-8 `src` of length `src_len` from UTF-8 to ECI
+    `eci`, and place in `p_dest_len`.
     Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not
  */
 ZUECI_EXTERN int zueci_dest_len_eci(const int eci, const unsigned char src[], const int src_len, int *p_dest_len) {
@@ -1467,72 +1719,258 @@ ZUECI_EXTERN int zueci_dest_len_eci(const int eci, const unsigned char src[], co
 
     return 0;
 }
-#endif /* ZUECI_EMBED_NO_TO_ECI */
 
-#ifndef ZUECI_EMBED_NO_TO_UTF8
-/* ECI to Unicode function table */
-typedef int (*zueci_utf8_func_t)(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
-                                    zueci_u32 *p_u);
-static const zueci_utf8_func_t zueci_utf8_funcs[36] = {
-         zueci_cp437_u,               NULL,      zueci_cp437_u,               NULL,  fake, /*0-4*/
-     fake,  fake,  fake,  fake,  fake, /*5-9*/
-         fake,  fake, fake, fake,               NULL, /*10-14*/
-         fake, fake, fake, fake,               NULL, /*15-19*/
-          zueci_sjis_u,     fake,     fake,     fake,     fake, /*20-24*/
-       zueci_utf16be_u,               NULL,      zueci_ascii_u,       zueci_big5_u,     zueci_gb2312_u, /*25-29*/
-       zueci_ksx1001_u,        zueci_gbk_u,    zueci_gb18030_u,    zueci_utf16le_u,    zueci_utf32be_u, /*30-34*/
-       zueci_utf32le_u,
-};
+/* Maximum number of `eci` bytes produced per UTF-8 byte (see `zueci_dest_len_eci()`) */
+static int zueci_eci_expansion(const int eci) {
+    if (eci == 34 || eci == 35) { /* UTF-32 */
+        return 4;
+    }
+    if (eci == 20 || eci == 25 || eci == 32 || eci == 33) { /* Shift JIS backslash, UTF-16, GB 18030 4-byters */
+        return 2;
+    }
+    return 1;
+}
 
 /*
-    Convert ECI-encoded `src` of length `src_len` to UTF-8 `dest`.
-    `p_dest_len` is set to length of `dest` on output.
-    `dest` must be big enough (4-times the `src_len`, or see `zueci_dest_len_utf8()`). It is not NUL-terminated.
-    If the Unicode BMP `replacement_char` (<= 0xFFFF) is non-zero then it will substituted for all source characters
-    with no mapping and processing will continue, returning ZUECI_WARN_INVALID_DATA unless other errors.
-    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
-*/
-ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], const int src_len,
-                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
-                    int *p_dest_len) {
-    const unsigned char *s = src;
-    const unsigned char *const se = src + src_len;
-    unsigned char *d = dest;
-    zueci_utf8_func_t utf8_func;
-    zueci_u32 u;
-    int src_incr;
-    unsigned char replacement[5];
-    int replacement_len;
-    int ret = 0;
+    Convert as much of UTF-8 `src` of length `src_len` to `eci`-encoded `dest` as fits in `dest_size`.
+    Returns 0 if successful, ZUECI_WARN_DEST_FULL if `dest` full, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_bounded(const int eci, const unsigned char src[], const int src_len,
+                    unsigned char dest[], const int dest_size, int *p_src_used, int *p_dest_len) {
+    int s = 0, d = 0;
+    int expansion;
 
     if (!zueci_is_valid_eci(eci)) {
         return ZUECI_ERROR_INVALID_ECI;
     }
-    if (!src || !dest || !p_dest_len) {
+    if (!src || !dest || dest_size < 0 || !p_src_used || !p_dest_len) {
         return ZUECI_ERROR_INVALID_ARGS;
     }
+    expansion = zueci_eci_expansion(eci);
+
+    /* Convert in segments that can't overflow, ending on UTF-8 character boundaries */
+    while (s < src_len) {
+        const int left = dest_size - d;
+        int n = left / expansion;
+        int len, ret, i;
+
+        if (n >= src_len - s) {
+            n = src_len - s;
+        } else {
+            /* Back up to start of any character split by segment end */
+            for (i = 0; i < 3 && n > 0 && (src[s + n] & 0xC0) == 0x80; i++, n--);
+        }
+        if (n) {
+            if ((ret = zueci_utf8_to_eci(eci, src + s, n, dest + d, &len))) {
+                return ret;
+            }
+        } else {
+            /* Not enough room for worst case, so convert next character to buffer and see if fits */
+            unsigned char buf[16];
+            for (n = 1; n < 4 && s + n < src_len && (src[s + n] & 0xC0) == 0x80; n++);
+            if ((ret = zueci_utf8_to_eci(eci, src + s, n, buf, &len))) {
+                return ret;
+            }
+            if (len > left) {
+                break;
+            }
+            memcpy(dest + d, buf, len);
+        }
+        s += n;
+        d += len;
+    }
+
+    *p_src_used = s;
+    *p_dest_len = d;
+
+    return s < src_len ? ZUECI_WARN_DEST_FULL : 0;
+}
+
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* Define `zueci_eci_to_utf8_<name>()` and `zueci_dest_len_utf8_<name>()`, the main loops of `zueci_eci_to_utf8()`
+   and `zueci_dest_len_utf8()` specialized for ECI to Unicode routine `utf8_func`, so that it's called directly (and
+   can be inlined) rather than through a function pointer. `ascii_direct` may depend on `flags`.
+   If `partial` set, `zueci_eci_to_utf8_<name>()` stops at an unconvertible sequence within 4 bytes of the end, as it
+   may be completed by the next chunk (see `zueci_stream_feed()`), setting `*p_s` to its start */
+#define ZUECI_ECI_TO_UTF8_LOOPS(name, utf8_func, ascii_direct) \
+static int zueci_eci_to_utf8_##name(const int eci, const unsigned char **p_s, const unsigned char *const se, \
+            const unsigned int flags, const unsigned char replacement[], const int replacement_len, \
+            const int partial, unsigned char **p_d) { \
+    const unsigned char *s = *p_s; \
+    unsigned char *d = *p_d; \
+    zueci_u32 u = 0; /* Not set by the `zueci_none_u()` stub - avoids maybe-uninitialized warnings */ \
+    int src_incr; \
+    int ret = 0; \
+    while (s < se) { \
+        if ((ascii_direct) && *s < 0x80) { /* Bulk copy ASCII runs, bypassing `utf8_func` & encoder */ \
+            const int run = zueci_ascii_copy(s, (int) (se - s), d); \
+            s += run; \
+            d += run; \
+            continue; \
+        } \
+        if (!(src_incr = utf8_func(s, (zueci_u32) (se - s), flags, &u))) { \
+            if (partial && se - s < 4) { /* May be incomplete, leave for next chunk */ \
+                break; \
+            } \
+            if (!replacement_len) { \
+                return ZUECI_ERROR_INVALID_DATA; \
+            } \
+            memcpy(d, replacement, replacement_len); \
+            s += zueci_replacement_incr(eci, s, (zueci_u32) (se - s)); \
+            d += replacement_len; \
+            ret = ZUECI_WARN_INVALID_DATA; \
+        } else { \
+            s += src_incr; \
+            d += zueci_encode_utf8(u, d); \
+        } \
+    } \
+    *p_s = s; \
+    *p_d = d; \
+    return ret; \
+} \
+static int zueci_dest_len_utf8_##name(const int eci, const unsigned char *s, const unsigned char *const se, \
+            const unsigned int flags, const int replacement_len, int *p_dest_len) { \
+    int dest_len = *p_dest_len; \
+    zueci_u32 u = 0; \
+    int src_incr; \
+    int ret = 0; \
+    while (s < se) { \
+        if ((ascii_direct) && *s < 0x80) { \
+            const int run = zueci_ascii_len(s, (int) (se - s)); \
+            s += run; \
+            dest_len += run; \
+            continue; \
+        } \
+        if (!(src_incr = utf8_func(s, (zueci_u32) (se - s), flags, &u))) { \
+            if (!replacement_len) { \
+                return ZUECI_ERROR_INVALID_DATA; \
+            } \
+            s += zueci_replacement_incr(eci, s, (zueci_u32) (se - s)); \
+            dest_len += replacement_len; \
+            ret = ZUECI_WARN_INVALID_DATA; \
+        } else { \
+            s += src_incr; \
+            dest_len += 1 + (u >= 0x80) + (u >= 0x800) + (u >= 0x10000); \
+        } \
+    } \
+    *p_dest_len = dest_len; \
+    return ret; \
+}
+
+ZUECI_ECI_TO_UTF8_LOOPS(cp437, zueci_cp437_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_1, zueci_iso8859_1_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_2, zueci_iso8859_2_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_3, zueci_iso8859_3_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_4, zueci_iso8859_4_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_5, zueci_iso8859_5_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_6, zueci_iso8859_6_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_7, zueci_iso8859_7_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_8, zueci_iso8859_8_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_9, zueci_iso8859_9_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_10, zueci_iso8859_10_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_11, zueci_iso8859_11_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_13, zueci_iso8859_13_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_14, zueci_iso8859_14_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_15, zueci_iso8859_15_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(iso8859_16, zueci_iso8859_16_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(sjis, zueci_sjis_u, flags & ZUECI_FLAG_SJIS_STRAIGHT_THRU)
+ZUECI_ECI_TO_UTF8_LOOPS(cp1250, zueci_cp1250_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(cp1251, zueci_cp1251_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(cp1252, zueci_cp1252_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(cp1256, zueci_cp1256_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(utf16be, zueci_utf16be_u, 0)
+ZUECI_ECI_TO_UTF8_LOOPS(ascii, zueci_ascii_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(big5, zueci_big5_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(gb2312, zueci_gb2312_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(ksx1001, zueci_ksx1001_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(gbk, zueci_gbk_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(gb18030, zueci_gb18030_u, 1)
+ZUECI_ECI_TO_UTF8_LOOPS(utf16le, zueci_utf16le_u, 0)
+ZUECI_ECI_TO_UTF8_LOOPS(utf32be, zueci_utf32be_u, 0)
+ZUECI_ECI_TO_UTF8_LOOPS(utf32le, zueci_utf32le_u, 0)
+ZUECI_ECI_TO_UTF8_LOOPS(ascii_inv, zueci_ascii_inv_u, 0) /* Straight-thru dealt with as special case */
+
+/* Dispatch once to the loop `func` specialized for `eci`, placing result in `ret` */
+#define ZUECI_ECI_TO_UTF8_DISPATCH(func, ret, args) \
+    switch (eci) { \
+        case 0: case 2: ret = func##_cp437 args; break; \
+        case 4: ret = func##_iso8859_2 args; break; \
+        case 5: ret = func##_iso8859_3 args; break; \
+        case 6: ret = func##_iso8859_4 args; break; \
+        case 7: ret = func##_iso8859_5 args; break; \
+        case 8: ret = func##_iso8859_6 args; break; \
+        case 9: ret = func##_iso8859_7 args; break; \
+        case 10: ret = func##_iso8859_8 args; break; \
+        case 11: ret = func##_iso8859_9 args; break; \
+        case 12: ret = func##_iso8859_10 args; break; \
+        case 13: ret = func##_iso8859_11 args; break; \
+        case 15: ret = func##_iso8859_13 args; break; \
+        case 16: ret = func##_iso8859_14 args; break; \
+        case 17: ret = func##_iso8859_15 args; break; \
+        case 18: ret = func##_iso8859_16 args; break; \
+        case 20: ret = func##_sjis args; break; \
+        case 21: ret = func##_cp1250 args; break; \
+        case 22: ret = func##_cp1251 args; break; \
+        case 23: ret = func##_cp1252 args; break; \
+        case 24: ret = func##_cp1256 args; break; \
+        case 25: ret = func##_utf16be args; break; \
+        case 27: ret = func##_ascii args; break; \
+        case 28: ret = func##_big5 args; break; \
+        case 29: ret = func##_gb2312 args; break; \
+        case 30: ret = func##_ksx1001 args; break; \
+        case 31: ret = func##_gbk args; break; \
+        case 32: ret = func##_gb18030 args; break; \
+        case 33: ret = func##_utf16le args; break; \
+        case 34: ret = func##_utf32be args; break; \
+        case 35: ret = func##_utf32le args; break; \
+        case 170: ret = func##_ascii_inv args; break; \
+        default: ret = func##_iso8859_1 args; break; /* ECIs 1 and 3 */ \
+    }
+
+/* Whether `eci` copied straight-thru, i.e. Binary, and if straight-thru flag set then ISO/IEC 8859-1, ASCII and
+   ISO/IEC 646 Invariant also */
+static int zueci_is_straight_thru(const int eci, const unsigned int flags) {
+    return eci == 899 || ((flags & ZUECI_FLAG_SB_STRAIGHT_THRU) && (eci == 1 || eci == 3 || eci == 27 || eci == 170));
+}
+
+/* Main body of `zueci_eci_to_utf8()`, args already checked and replacement character (if any) encoded */
+static int zueci_eci_to_utf8_core(const int eci, const unsigned char src[], const int src_len,
+            const unsigned int flags, const unsigned char replacement[], const int replacement_len,
+            unsigned char dest[], int *p_dest_len) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    unsigned char *d = dest;
+    zueci_u32 u;
+    int ret = 0;
 
     /* Special case Binary, and if straight-thru flag set then ISO/IEC 8859-1, ASCII and ISO/IEC 646 Invariant also */
-    if (eci == 899 || ((flags & ZUECI_FLAG_SB_STRAIGHT_THRU) && (eci == 1 || eci == 3 || eci == 27 || eci == 170))) {
+    if (zueci_is_straight_thru(eci, flags)) {
         while (s < se) {
+            if (*s < 0x80) {
+                const int run = zueci_ascii_copy(s, (int) (se - s), d);
+                s += run;
+                d += run;
+                continue;
+            }
             d += zueci_encode_utf8(*s++, d);
         }
         *p_dest_len = (int) (d - dest);
         return 0;
     }
 
-    if (replacement_char) {
-        if (!ZUECI_IS_VALID_UNICODE(replacement_char) || replacement_char > 0xFFFF) { /* Allow BMP only */
-            return ZUECI_ERROR_INVALID_ARGS;
-        }
-        replacement_len = zueci_encode_utf8(replacement_char, replacement);
-    }
-
     /* Special case ISO/IEC 8859-1 */
     if (eci == 1 || eci == 3) {
-        for (; s < se; s++) {
-            if (*s >= 0x80 && *s < 0xA0) {
-                if (!replacement_char) {
+        while (s < se) {
+            if (*s < 0x80) {
+                const int run = zueci_ascii_copy(s, (int) (se - s), d);
+                s += run;
+                d += run;
+                continue;
+            }
+            if (*s < 0xA0) {
+                if (!replacement_len) {
                     return ZUECI_ERROR_INVALID_DATA;
                 }
                 memcpy(d, replacement, replacement_len);
@@ -1541,6 +1979,7 @@ ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], con
             } else {
                 d += zueci_encode_utf8(*s, d);
             }
+            s++;
         }
         *p_dest_len = (int) (d - dest);
         return ret;
@@ -1548,7 +1987,7 @@ ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], con
 
     /* Special case UTF-8 */
     if (eci == 26) {
-        if (replacement_char) {
+        if (replacement_len) {
             unsigned int state = 0;
             while (s < se) {
                 do {
@@ -1573,36 +2012,102 @@ ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], con
             *p_dest_len = (int) (d - dest);
             return ret;
         }
-        if (!zueci_is_valid_utf8(src, src_len)) {
+        if (!zueci_utf8_copy_valid(src, src_len, dest)) {
             return ZUECI_ERROR_INVALID_UTF8;
         }
-        memcpy(dest, src, src_len);
         *p_dest_len = src_len;
         return 0;
     }
 
-    if (eci == 170) {
-        utf8_func = zueci_ascii_inv_u;
-    } else {
-        utf8_func = zueci_utf8_funcs[eci];
+    ZUECI_ECI_TO_UTF8_DISPATCH(zueci_eci_to_utf8, ret, (eci, &s, se, flags, replacement, replacement_len, 0, &d));
+    if (ret >= ZUECI_ERROR) {
+        return ret;
     }
+    *p_dest_len = (int) (d - dest);
+    return ret;
+}
 
-    while (s < se) {
-        if (!(src_incr = (*utf8_func)(s, (int) (se - s), flags, &u))) {
-            if (!replacement_char) {
-                return ZUECI_ERROR_INVALID_DATA;
-            }
-            memcpy(d, replacement, replacement_len);
-            s += zueci_replacement_incr(eci, s, (int) (se - s));
-            d += replacement_len;
-            ret = ZUECI_WARN_INVALID_DATA;
-        } else {
-            s += src_incr;
-            d += zueci_encode_utf8(u, d);
+/* Check `replacement_char` and encode it in `replacement`, setting `*p_replacement_len` (zero if none). Not checked
+   if `eci` straight-thru, as then unused. Returns 0 if successful, ZUECI_ERROR_INVALID_ARGS if not */
+static int zueci_replacement_encode(const int eci, const unsigned int replacement_char, const unsigned int flags,
+            unsigned char replacement[5], int *p_replacement_len) {
+    *p_replacement_len = 0;
+    if (replacement_char && !zueci_is_straight_thru(eci, flags)) {
+        if (!ZUECI_IS_VALID_UNICODE(replacement_char) || replacement_char > 0xFFFF) { /* Allow BMP only */
+            return ZUECI_ERROR_INVALID_ARGS;
         }
+        *p_replacement_len = zueci_encode_utf8(replacement_char, replacement);
     }
-    *p_dest_len = (int) (d - dest);
-    return ret;
+    return 0;
+}
+
+/*
+    Convert ECI-encoded `src` of length `src_len` to UTF-8 `dest`.
+    `p_dest_len` is set to length of `dest` on output.
+    `dest` must be big enough (4-times the `src_len`, or see `zueci_dest_len_utf8()`). It is not NUL-terminated.
+    If the Unicode BMP `replacement_char` (<= 0xFFFF) is non-zero then it will substituted for all source characters
+    with no mapping and processing will continue, returning ZUECI_WARN_INVALID_DATA unless other errors.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+*/
+ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
+                    int *p_dest_len) {
+    unsigned char replacement[5];
+    int replacement_len;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!src || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    if (zueci_replacement_encode(eci, replacement_char, flags, replacement, &replacement_len)) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    return zueci_eci_to_utf8_core(eci, src, src_len, flags, replacement, replacement_len, dest, p_dest_len);
+}
+
+/*
+    Convert `count` ECI-encoded strings `srcs` of lengths `src_lens` to UTF-8 `dest`, placing each at
+    `dest_offsets` with per-item statuses in `rets`.
+    Returns the highest of `rets`, or one of `ZUECI_ERROR_XXX` if args invalid.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_batch(const int eci, const unsigned char *const srcs[], const int src_lens[],
+                    const int count, const unsigned int replacement_char, const unsigned int flags,
+                    unsigned char dest[], int dest_offsets[], int rets[]) {
+    unsigned char replacement[5];
+    int replacement_len;
+    int d = 0;
+    int ret_max = 0;
+    int i;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!srcs || !src_lens || count < 0 || !dest || !dest_offsets || !rets) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    if (zueci_replacement_encode(eci, replacement_char, flags, replacement, &replacement_len)) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    for (i = 0; i < count; i++) {
+        int len = 0;
+        dest_offsets[i] = d;
+        if (!srcs[i] || src_lens[i] < 0) {
+            rets[i] = ZUECI_ERROR_INVALID_ARGS;
+        } else if ((rets[i] = zueci_eci_to_utf8_core(eci, srcs[i], src_lens[i], flags, replacement, replacement_len,
+                        dest + d, &len)) < ZUECI_ERROR) {
+            d += len;
+        }
+        if (rets[i] > ret_max) {
+            ret_max = rets[i];
+        }
+    }
+    dest_offsets[count] = d;
+
+    return ret_max;
 }
 
 /*
@@ -1614,11 +2119,9 @@ ZUECI_EXTERN int zueci_dest_len_utf8(const int eci, const unsigned char src[], c
                 const unsigned int replacement_char, const int unsigned flags, int *p_dest_len) {
     const unsigned char *s = src;
     const unsigned char *const se = src + src_len;
-    zueci_utf8_func_t utf8_func;
     zueci_u32 u;
-    int src_incr;
     unsigned char replacement[5];
-    int replacement_len = 0; /* g++ complains with "-Wmaybe-uninitialized" if this isn't set */
+    int replacement_len = 0;
     int dest_len = 0;
     int ret = 0;
 
@@ -1632,7 +2135,7 @@ ZUECI_EXTERN int zueci_dest_len_utf8(const int eci, const unsigned char src[], c
     }
 
     /* Special case Binary, and if straight-thru flag set then ISO/IEC 8859-1, ASCII and ISO/IEC 646 Invariant also */
-    if (eci == 899 || ((flags & ZUECI_FLAG_SB_STRAIGHT_THRU) && (eci == 1 || eci == 3 || eci == 27 || eci == 170))) {
+    if (zueci_is_straight_thru(eci, flags)) {
         while (s < se) {
             dest_len += 1 + (*s++ >= 0x80);
         }
@@ -1693,26 +2196,739 @@ ZUECI_EXTERN int zueci_dest_len_utf8(const int eci, const unsigned char src[], c
         return ret;
     }
 
-    if (eci == 170) {
-        utf8_func = zueci_ascii_inv_u;
-    } else {
-        utf8_func = zueci_utf8_funcs[eci];
+    ZUECI_ECI_TO_UTF8_DISPATCH(zueci_dest_len_utf8, ret, (eci, s, se, flags, replacement_len, &dest_len));
+    if (ret >= ZUECI_ERROR) {
+        return ret;
+    }
+    *p_dest_len = dest_len;
+    return ret;
+}
+
+/* Whether `eci` is single-byte, i.e. never has sequences split across chunks */
+static int zueci_is_sb_eci(const int eci) {
+    return eci <= 18 || (eci >= 21 && eci <= 24) || eci == 27 || eci == 170 || eci == 899;
+}
+
+/*
+    Initialize `stream` to convert ECI-encoded data from ECI `eci` to UTF-8.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_stream_init(zueci_stream *stream, const int eci, const unsigned int replacement_char,
+                    const unsigned int flags) {
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!stream) {
+        return ZUECI_ERROR_INVALID_ARGS;
     }
+    if (replacement_char && (!ZUECI_IS_VALID_UNICODE(replacement_char) || replacement_char > 0xFFFF)) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    memset(stream, 0, sizeof(*stream));
+    stream->eci = eci;
+    stream->replacement_char = replacement_char;
+    stream->flags = flags;
+
+    return 0;
+}
+
+/* Convert UTF-8 chunk `s` to `se`, carrying the decoder state over from the previous chunk in `stream`. Same as the
+   ECI 26 special case of `zueci_eci_to_utf8()` except that an incomplete sequence at the end is left pending */
+static int zueci_stream_utf8(zueci_stream *const stream, const unsigned char *s, const unsigned char *const se,
+            const unsigned char replacement[], const int replacement_len, unsigned char **p_d) {
+    unsigned char *d = *p_d;
+    unsigned int state = stream->state;
+    zueci_u32 u = stream->u;
+    int ret = 0;
 
     while (s < se) {
-        if (!(src_incr = (*utf8_func)(s, (int) (se - s), flags, &u))) {
-            if (!replacement_char) {
-                return ZUECI_ERROR_INVALID_DATA;
+        if (state == 0) {
+            if (stream->skip) {
+                if ((*s & 0xC0) == 0x80) { /* Skip any continuation bytes following replacement */
+                    s++;
+                    continue;
+                }
+                stream->skip = 0;
             }
-            s += zueci_replacement_incr(eci, s, (int) (se - s));
-            dest_len += replacement_len;
+            if (!replacement_len) {
+                /* Validate & copy up to any incomplete trailing sequence, which is left to the decoder below */
+                int len = (int) (se - s);
+                int i;
+                for (i = 1; i <= 3 && i <= len; i++) {
+                    const unsigned char c = s[len - i];
+                    if (c >= 0xC0) {
+                        if (i < (c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2)) {
+                            len -= i;
+                        }
+                        break;
+                    }
+                    if (c < 0x80) {
+                        break;
+                    }
+                }
+                if (!zueci_utf8_copy_valid(s, len, d)) {
+                    return ZUECI_ERROR_INVALID_UTF8;
+                }
+                s += len;
+                d += len;
+                if (s == se) {
+                    break;
+                }
+            } else if (*s < 0x80) {
+                const int run = zueci_ascii_copy(s, (int) (se - s), d);
+                s += run;
+                d += run;
+                continue;
+            }
+        }
+        zueci_decode_utf8(&state, &u, *s++);
+        if (state == 0) {
+            d += zueci_encode_utf8(u, d);
+        } else if (state == 12) {
+            if (!replacement_len) {
+                return ZUECI_ERROR_INVALID_UTF8;
+            }
+            if (*(s - 1) < 0x80) { /* If previous ASCII, backtrack */
+                s--;
+            } else {
+                stream->skip = 1;
+            }
+            memcpy(d, replacement, replacement_len);
+            d += replacement_len;
             ret = ZUECI_WARN_INVALID_DATA;
+            state = 0;
+        }
+    }
+    stream->state = state;
+    stream->u = u;
+
+    *p_d = d;
+    return ret;
+}
+
+/*
+    Convert the next chunk `src` of length `src_len` to UTF-8 `dest`, holding back any incomplete trailing sequence.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_stream_feed(zueci_stream *stream, const unsigned char src[], const int src_len,
+                    unsigned char dest[], int *p_dest_len) {
+    const unsigned char *s = src;
+    const unsigned char *const se = src + src_len;
+    unsigned char *d = dest;
+    unsigned char replacement[5];
+    int replacement_len = 0;
+    int eci;
+    unsigned int flags;
+    int ret = 0, ret2;
+
+    if (!stream || !src || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    eci = stream->eci;
+    flags = stream->flags;
+
+    /* Single-byte, no state */
+    if (zueci_is_sb_eci(eci)) {
+        return zueci_eci_to_utf8(eci, src, src_len, stream->replacement_char, flags, dest, p_dest_len);
+    }
+
+    if (stream->replacement_char) {
+        replacement_len = zueci_encode_utf8(stream->replacement_char, replacement);
+    }
+
+    if (eci == 26) {
+        ret = zueci_stream_utf8(stream, s, se, replacement, replacement_len, &d);
+        if (ret >= ZUECI_ERROR) {
+            return ret;
+        }
+        *p_dest_len = (int) (d - dest);
+        return ret;
+    }
+
+    if (stream->pending_len) {
+        /* Join held back bytes with enough of `src` to complete any sequence starting in them */
+        unsigned char buf[4 + 3];
+        const unsigned char *b = buf;
+        const int pending_len = stream->pending_len;
+        const int len = pending_len + ZUECI_MIN(src_len, 3);
+        memcpy(buf, stream->pending, pending_len);
+        memcpy(buf + pending_len, src, len - pending_len);
+        ZUECI_ECI_TO_UTF8_DISPATCH(zueci_eci_to_utf8, ret,
+            (eci, &b, buf + len, flags, replacement, replacement_len, 1, &d));
+        if (ret >= ZUECI_ERROR) {
+            return ret;
+        }
+        if (b - buf < pending_len) { /* Still incomplete, so all of `src` used */
+            assert(len - pending_len == src_len);
+            stream->pending_len = (int) (buf + len - b);
+            memmove(stream->pending, b, stream->pending_len);
+            *p_dest_len = (int) (d - dest);
+            return ret;
+        }
+        s += b - buf - pending_len;
+        stream->pending_len = 0;
+    }
+
+    ZUECI_ECI_TO_UTF8_DISPATCH(zueci_eci_to_utf8, ret2,
+        (eci, &s, se, flags, replacement, replacement_len, 1, &d));
+    if (ret2 >= ZUECI_ERROR) {
+        return ret2;
+    }
+    assert(se - s < 4);
+    stream->pending_len = (int) (se - s);
+    memcpy(stream->pending, s, stream->pending_len);
+
+    *p_dest_len = (int) (d - dest);
+    return ret2 ? ret2 : ret;
+}
+
+/*
+    Flush any incomplete sequence held back by `stream` to UTF-8 `dest`, and reset `stream`.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_stream_finish(zueci_stream *stream, unsigned char dest[], int *p_dest_len) {
+    int ret = 0;
+
+    if (!stream || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    *p_dest_len = 0;
+    if (stream->eci == 26) {
+        if (stream->state != 0) { /* Incomplete at end */
+            if (!stream->replacement_char) {
+                return ZUECI_ERROR_INVALID_UTF8;
+            }
+            *p_dest_len = zueci_encode_utf8(stream->replacement_char, dest);
+            ret = ZUECI_WARN_INVALID_DATA;
+        }
+    } else if (stream->pending_len) {
+        ret = zueci_eci_to_utf8(stream->eci, stream->pending, stream->pending_len, stream->replacement_char,
+                stream->flags, dest, p_dest_len);
+        if (ret >= ZUECI_ERROR) {
+            return ret;
+        }
+    }
+
+    stream->state = 0;
+    stream->u = 0;
+    stream->skip = 0;
+    stream->pending_len = 0;
+
+    return ret;
+}
+
+/* Number of bytes of `src` up to `s` consumed by `stream` but not yet converted */
+static int zueci_stream_held(const zueci_stream *const stream, const unsigned char *const s) {
+    int held = 1;
+    if (stream->eci != 26) {
+        return stream->pending_len;
+    }
+    if (stream->state == 0) {
+        return 0;
+    }
+    while ((*(s - held) & 0xC0) == 0x80) { /* Back to lead byte */
+        held++;
+    }
+    return held;
+}
+
+/* Convert as much of `src` as fits in `dest_size` (args already checked), setting `*p_warn` if replacement character
+   used (as this is not returned if `dest` full) */
+static int zueci_eci_to_utf8_part(const int eci, const unsigned char src[], const int src_len,
+            const unsigned int replacement_char, const unsigned int flags, unsigned char dest[], const int dest_size,
+            int *p_src_used, int *p_dest_len, int *p_warn) {
+    zueci_stream stream;
+    int s = 0, d = 0;
+    int ret, ret_all = 0;
+
+    if ((ret = zueci_stream_init(&stream, eci, replacement_char, flags))) {
+        return ret;
+    }
+
+    /* Feed in segments that can't overflow, i.e. allowing 3 UTF-8 bytes for each source byte and each of up to 3
+       held back, then byte-by-byte via a buffer, backing out and stopping at the first that doesn't fit */
+    for (;;) {
+        const int left = dest_size - d;
+        const int held = zueci_stream_held(&stream, src + s);
+        int n = left / 3 - 3;
+        int len;
+
+        if (n > 0 && s < src_len) {
+            if (n > src_len - s) {
+                n = src_len - s;
+            }
+            if ((ret = zueci_stream_feed(&stream, src + s, n, dest + d, &len)) >= ZUECI_ERROR) {
+                return ret;
+            }
         } else {
-            s += src_incr;
-            dest_len += 1 + (u >= 0x80) + (u >= 0x800) + (u >= 0x10000);
+            unsigned char buf[16];
+            n = s < src_len;
+            if (n) {
+                ret = zueci_stream_feed(&stream, src + s, n, buf, &len);
+            } else {
+                ret = zueci_stream_finish(&stream, buf, &len);
+            }
+            if (ret >= ZUECI_ERROR) {
+                return ret;
+            }
+            if (len > left) {
+                s -= held;
+                break;
+            }
+            memcpy(dest + d, buf, len);
+        }
+        s += n;
+        d += len;
+        ret_all |= ret;
+        if (s == src_len && (n == 0 || zueci_stream_held(&stream, src + s) == 0)) { /* Finished or nothing to finish */
+            break;
         }
     }
-    *p_dest_len = dest_len;
+
+    *p_src_used = s;
+    *p_dest_len = d;
+    *p_warn |= ret_all;
+
+    return s < src_len ? ZUECI_WARN_DEST_FULL : ret_all;
+}
+
+/*
+    Convert as much of ECI-encoded `src` of length `src_len` to UTF-8 `dest` as fits in `dest_size`.
+    Returns 0 if successful, ZUECI_WARN_DEST_FULL if `dest` full, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_bounded(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
+                    const int dest_size, int *p_src_used, int *p_dest_len) {
+    int warn = 0;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!src || !dest || dest_size < 0 || !p_src_used || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    return zueci_eci_to_utf8_part(eci, src, src_len, replacement_char, flags, dest, dest_size, p_src_used,
+            p_dest_len, &warn);
+}
+
+/* Default `zueci_realloc_func` using `realloc()` & `free()` */
+static void *zueci_realloc(void *ctx, void *ptr, const int size) {
+    (void)ctx;
+    if (size == 0) {
+        free(ptr);
+        return NULL;
+    }
+    return realloc(ptr, (size_t) size);
+}
+
+/*
+    Convert ECI-encoded `src` of length `src_len` to UTF-8 in a single pass, allocating `*p_dest` with
+    `realloc_func` (or `realloc()` if NULL) and growing it as needed, then shrinking to fit.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_alloc(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, zueci_realloc_func realloc_func,
+                    void *ctx, unsigned char **p_dest, int *p_dest_len) {
+    unsigned char *dest = NULL;
+    int size, max_size;
+    int s = 0, d = 0;
+    int ret, warn = 0;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!src || src_len < 0 || !p_dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    if (!realloc_func) {
+        realloc_func = zueci_realloc;
+    }
+
+    /* Start with room for mostly ASCII/2-byte sequences, then grow geometrically, never beyond the maximum of 3
+       UTF-8 bytes per remaining source byte (plus 12 for any held back) */
+    size = src_len + (src_len >> 1) + 16;
+    for (;;) {
+        int src_used, dest_len;
+        unsigned char *new_dest = (unsigned char *) realloc_func(ctx, dest, size);
+        if (!new_dest) {
+            if (dest) {
+                realloc_func(ctx, dest, 0);
+            }
+            return ZUECI_ERROR_MEMORY;
+        }
+        dest = new_dest;
+        ret = zueci_eci_to_utf8_part(eci, src + s, src_len - s, replacement_char, flags, dest + d, size - d,
+                &src_used, &dest_len, &warn);
+        if (ret >= ZUECI_ERROR) {
+            realloc_func(ctx, dest, 0);
+            return ret;
+        }
+        s += src_used;
+        d += dest_len;
+        if (ret != ZUECI_WARN_DEST_FULL) {
+            break;
+        }
+        max_size = d + (src_len - s) * 3 + 12;
+        size = size < max_size - size ? size * 2 : max_size;
+    }
+
+    /* Shrink to fit, leaving room for a terminating NUL */
+    if (d + 1 < size) {
+        unsigned char *new_dest = (unsigned char *) realloc_func(ctx, dest, d + 1);
+        if (new_dest) {
+            dest = new_dest;
+        }
+    }
+
+    *p_dest = dest;
+    *p_dest_len = d;
+
+    return warn;
+}
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+
+/* Multi-threaded */
+
+#if !defined(ZUECI_EMBED_NO_TO_ECI) || !defined(ZUECI_EMBED_NO_TO_UTF8)
+/* Maximum number of threads used by `zueci_utf8_to_eci_mt()` & `zueci_eci_to_utf8_mt()`, and minimum source bytes
+   each */
+#define ZUECI_MT_MAX_THREADS    64
+#define ZUECI_MT_MIN_CHUNK      (64 * 1024)
+
+/* Phases of `zueci_mt_job` */
+#define ZUECI_MT_TO_ECI     1   /* Convert UTF-8 `src` to ECI `buf` */
+#define ZUECI_MT_TO_UTF8    2   /* Convert ECI `src` to UTF-8 `buf` */
+#define ZUECI_MT_COPY       3   /* Copy `buf` to `dest` */
+#define ZUECI_MT_LEN_UTF8   4   /* Set `buf_len` to exact length of ECI `src` converted to UTF-8 */
+
+/* A chunk of multi-threaded work */
+typedef struct zueci_mt_job {
+    int phase;
+    int eci;
+    unsigned int flags;
+    unsigned int replacement_char;
+    const unsigned char *replacement;
+    int replacement_len;
+    const unsigned char *src;
+    int src_len;
+    unsigned char *buf;
+    int buf_len;
+    unsigned char *dest;
+    int ret;
+} zueci_mt_job;
+
+static void zueci_mt_work(zueci_mt_job *const job) {
+#ifndef ZUECI_EMBED_NO_TO_ECI
+    if (job->phase == ZUECI_MT_TO_ECI) {
+        job->ret = zueci_utf8_to_eci_core(job->eci, job->src, job->src_len, job->buf, &job->buf_len);
+        return;
+    }
+#endif
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+    if (job->phase == ZUECI_MT_TO_UTF8) {
+        job->ret = zueci_eci_to_utf8_core(job->eci, job->src, job->src_len, job->flags, job->replacement,
+                        job->replacement_len, job->buf, &job->buf_len);
+        return;
+    }
+    if (job->phase == ZUECI_MT_LEN_UTF8) {
+        job->ret = zueci_dest_len_utf8(job->eci, job->src, job->src_len, job->replacement_char, job->flags,
+                        &job->buf_len);
+        return;
+    }
+#endif
+    if (job->buf != job->dest) {
+        memcpy(job->dest, job->buf, job->buf_len);
+    }
+}
+
+#ifdef ZUECI_THREADS
+#ifdef _WIN32
+static DWORD WINAPI zueci_mt_thread(LPVOID arg) {
+    zueci_mt_work((zueci_mt_job *) arg);
+    return 0;
+}
+#else
+static void *zueci_mt_thread(void *arg) {
+    zueci_mt_work((zueci_mt_job *) arg);
+    return NULL;
+}
+#endif
+#endif /* ZUECI_THREADS */
+
+/* Run `jobs` in parallel, the first on the calling thread (and any that can't get a thread also) */
+static void zueci_mt_run(zueci_mt_job jobs[], const int cnt) {
+#ifdef ZUECI_THREADS
+#ifdef _WIN32
+    HANDLE threads[ZUECI_MT_MAX_THREADS];
+#else
+    pthread_t threads[ZUECI_MT_MAX_THREADS];
+#endif
+    int started[ZUECI_MT_MAX_THREADS];
+    int i;
+
+    for (i = 1; i < cnt; i++) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, zueci_mt_thread, &jobs[i], 0, NULL);
+        started[i] = threads[i] != NULL;
+#else
+        started[i] = pthread_create(&threads[i], NULL, zueci_mt_thread, &jobs[i]) == 0;
+#endif
+    }
+    zueci_mt_work(&jobs[0]);
+    for (i = 1; i < cnt; i++) {
+        if (started[i]) {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        } else {
+            zueci_mt_work(&jobs[i]);
+        }
+    }
+#else
+    int i;
+    for (i = 0; i < cnt; i++) {
+        zueci_mt_work(&jobs[i]);
+    }
+#endif /* ZUECI_THREADS */
+}
+#endif /* !ZUECI_EMBED_NO_TO_ECI || !ZUECI_EMBED_NO_TO_UTF8 */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/*
+    Convert UTF-8 `src` of length `src_len` to `eci`-encoded `dest` using up to `threads` threads.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_mt(const int eci, const unsigned char src[], const int src_len,
+                    unsigned char dest[], int *p_dest_len, const int threads) {
+    zueci_mt_job jobs[ZUECI_MT_MAX_THREADS];
+    int cnt, i, s, d;
+    int ret = 0;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!src || src_len < 0 || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    cnt = ZUECI_MIN(threads, src_len / ZUECI_MT_MIN_CHUNK);
+    if (cnt > ZUECI_MT_MAX_THREADS) {
+        cnt = ZUECI_MT_MAX_THREADS;
+    }
+    if (cnt <= 1) {
+        return zueci_utf8_to_eci_core(eci, src, src_len, dest, p_dest_len);
+    }
+
+    /* Split at UTF-8 character boundaries, i.e. not before continuation bytes (unless more than 3, so invalid) */
+    for (i = 0, s = 0; i < cnt; i++) {
+        int e = i + 1 == cnt ? src_len : (int) ((long long) src_len * (i + 1) / cnt);
+        int j;
+        for (j = 0; j < 3 && e > s && e < src_len && (src[e] & 0xC0) == 0x80; j++, e--);
+        jobs[i].phase = ZUECI_MT_TO_ECI;
+        jobs[i].eci = eci;
+        jobs[i].src = src + s;
+        jobs[i].src_len = e - s;
+        jobs[i].buf_len = 0;
+        jobs[i].ret = 0;
+        s = e;
+    }
+
+    /* Phase 1: convert each chunk, the first straight into `dest`, the rest into buffers, which gives their exact
+       lengths (a separate counting pass would have to do the same conversion work) */
+    jobs[0].buf = dest;
+    for (i = 1; i < cnt; i++) {
+        int buf_size = 0;
+        zueci_dest_len_eci(eci, jobs[i].src, jobs[i].src_len, &buf_size);
+        if (!(jobs[i].buf = (unsigned char *) malloc(buf_size + 1))) {
+            for (i--; i > 0; i--) {
+                free(jobs[i].buf);
+            }
+            return ZUECI_ERROR_MEMORY;
+        }
+    }
+    zueci_mt_run(jobs, cnt);
+
+    /* Prefix-sum offsets, noting first error */
+    for (i = 0, d = 0; i < cnt; i++) {
+        if (jobs[i].ret && !ret) {
+            ret = jobs[i].ret;
+        }
+        jobs[i].phase = ZUECI_MT_COPY;
+        jobs[i].dest = dest + d;
+        d += jobs[i].buf_len;
+    }
+
+    /* Phase 2: scatter into `dest` */
+    if (!ret) {
+        zueci_mt_run(jobs, cnt);
+    }
+    for (i = 1; i < cnt; i++) {
+        free(jobs[i].buf);
+    }
+    if (ret) {
+        return ret;
+    }
+
+    *p_dest_len = d;
+
+    return 0;
+}
+
+/*
+    Set `p_hits` and `p_misses` to the calling thread's GBK/GB 18030 encode cache lookup counts, resetting them
+    after if `reset` set. Both are always 0 unless built with `ZUECI_ENCODE_CACHE` defined.
+    Returns 0 if successful, ZUECI_ERROR_INVALID_ARGS if `p_hits` or `p_misses` NULL.
+ */
+ZUECI_EXTERN int zueci_encode_cache_stats(unsigned long long *p_hits, unsigned long long *p_misses,
+                    const int reset) {
+    if (!p_hits || !p_misses) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+#ifdef ZUECI_USE_ENCODE_CACHE
+    *p_hits = zueci_cache_hits;
+    *p_misses = zueci_cache_misses;
+    if (reset) {
+        zueci_cache_hits = zueci_cache_misses = 0;
+    }
+#else
+    (void)reset;
+    *p_hits = *p_misses = 0;
+#endif
+
+    return 0;
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* Whether `eci`-encoded `src` can be split before position `p` (0 < p < src_len - 3), i.e. whatever precedes it,
+   `zueci_eci_to_utf8()` will have finished a character or unconvertible sequence there (see
+   `zueci_replacement_incr()`), and so converting `src` in two parts gives the same result as one-shot */
+static int zueci_is_split_point(const int eci, const unsigned char src[], const int p) {
+    if (zueci_is_sb_eci(eci)) {
+        return 1;
+    }
+    switch (eci) {
+        case 25: /* UTF-16BE - if even and not a trail surrogate */
+            return !(p & 1) && (src[p] & 0xFC) != 0xDC;
+        case 33: /* UTF-16LE */
+            return !(p & 1) && (src[p + 1] & 0xFC) != 0xDC;
+        case 34: case 35: /* UTF-32BE/LE */
+            return !(p & 3);
+        case 26: /* UTF-8 - if ASCII, as never part of a sequence (invalid or not) */
+            return src[p] < 0x80;
+        case 32: /* GB 18030 - as double-byte, except an ASCII byte may be the 3rd byte of a 4-byter
+                    [81-FE][30-39][..][..], so need 2 ASCII bytes, the first not [30-39] */
+            return src[p - 1] < 0x80 && p >= 2
+                    && (src[p - 2] < 0x30 || (src[p - 2] > 0x39 && src[p - 2] < 0x80));
+    }
+    /* Double-byte - if preceded by ASCII, as it's either a single byte or a trail byte, never a lead byte */
+    return src[p - 1] < 0x80;
+}
+
+/* How far beyond a nominal end to look for a split point before trying the next nominal end instead */
+#define ZUECI_MT_SPLIT_SCAN     4096
+
+/* Split `src` of length `src_len` into at most `max_cnt` chunks, placing their ends in `ends` and returning their
+   count. Each chunk ends at the first split point at or after a nominal end (`src_len` split evenly), or if there's
+   none nearby, at the first one after the next nominal end, so that a region without split points only merges the
+   chunks it covers */
+static int zueci_mt_split_utf8(const int eci, const unsigned char src[], const int src_len, const int max_cnt,
+            int ends[]) {
+    int cnt = 0, k, s = 0;
+
+    for (k = 1; k < max_cnt; k++) {
+        const int end = (int) ((long long) src_len * k / max_cnt);
+        const int scan_end = ZUECI_MIN(end + ZUECI_MT_SPLIT_SCAN, src_len - 3);
+        int e;
+        for (e = end > s ? end : s + 1; e < scan_end && !zueci_is_split_point(eci, src, e); e++);
+        if (e < scan_end) {
+            ends[cnt++] = s = e;
+        }
+    }
+    ends[cnt++] = src_len;
+
+    return cnt;
+}
+
+#ifdef ZUECI_TEST /* Wrapper to make available for use by tests */
+ZUECI_INTERN int zueci_mt_split_utf8_test(const int eci, const unsigned char src[], const int src_len,
+                    const int max_cnt, int ends[]) {
+    return zueci_mt_split_utf8(eci, src, src_len, max_cnt, ends);
+}
+#endif
+
+/*
+    Convert ECI-encoded `src` of length `src_len` to UTF-8 `dest` using up to `threads` threads.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_mt(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
+                    int *p_dest_len, const int threads) {
+    zueci_mt_job jobs[ZUECI_MT_MAX_THREADS];
+    int ends[ZUECI_MT_MAX_THREADS];
+    unsigned char replacement[5];
+    int replacement_len;
+    int cnt, max_cnt, i, s, d;
+    int ret = 0;
+
+    if (!zueci_is_valid_eci(eci)) {
+        return ZUECI_ERROR_INVALID_ECI;
+    }
+    if (!src || src_len < 0 || !dest || !p_dest_len) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+    if (zueci_replacement_encode(eci, replacement_char, flags, replacement, &replacement_len)) {
+        return ZUECI_ERROR_INVALID_ARGS;
+    }
+
+    max_cnt = ZUECI_MIN(threads, src_len / ZUECI_MT_MIN_CHUNK);
+    if (max_cnt > ZUECI_MT_MAX_THREADS) {
+        max_cnt = ZUECI_MT_MAX_THREADS;
+    }
+    if (max_cnt <= 1 || (cnt = zueci_mt_split_utf8(eci, src, src_len, max_cnt, ends)) == 1) {
+        return zueci_eci_to_utf8_core(eci, src, src_len, flags, replacement, replacement_len, dest, p_dest_len);
+    }
+
+    for (i = 0, s = 0; i < cnt; i++) {
+        jobs[i].phase = ZUECI_MT_LEN_UTF8;
+        jobs[i].eci = eci;
+        jobs[i].flags = flags;
+        jobs[i].replacement_char = replacement_char;
+        jobs[i].replacement = replacement;
+        jobs[i].replacement_len = replacement_len;
+        jobs[i].src = src + s;
+        jobs[i].src_len = ends[i] - s;
+        jobs[i].buf_len = 0;
+        jobs[i].ret = 0;
+        s = ends[i];
+    }
+
+    /* Phase 1: count each chunk's exact UTF-8 length */
+    zueci_mt_run(jobs, cnt);
+
+    /* Return the first error if any, else the warning if any, and prefix-sum offsets */
+    for (i = 0, d = 0; i < cnt; i++) {
+        if (jobs[i].ret >= ZUECI_ERROR) {
+            return jobs[i].ret;
+        }
+        if (jobs[i].ret > ret) {
+            ret = jobs[i].ret;
+        }
+        jobs[i].phase = ZUECI_MT_TO_UTF8;
+        jobs[i].buf = dest + d;
+        d += jobs[i].buf_len;
+    }
+
+    /* Phase 2: convert each chunk straight into its place in `dest` */
+    zueci_mt_run(jobs, cnt);
+
+    *p_dest_len = d;
+
     return ret;
 }
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
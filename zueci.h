@@ -12,11 +12,13 @@
 
 /* Warning and error returns from API functions below */
 #define ZUECI_WARN_INVALID_DATA     1   /* Invalid data but replacement character used */
+#define ZUECI_WARN_DEST_FULL        2   /* Destination full before source all converted (bounded functions only) */
 #define ZUECI_ERROR                 5   /* Warn/error marker, not returned */
 #define ZUECI_ERROR_INVALID_DATA    6   /* Source data invalid or unmappable */
 #define ZUECI_ERROR_INVALID_ECI     7   /* ECI not a valid Character Set ECI */
 #define ZUECI_ERROR_INVALID_ARGS    8   /* One or more arguments invalid (e.g. NULL) */
 #define ZUECI_ERROR_INVALID_UTF8    9   /* Source data not valid UTF-8 */
+#define ZUECI_ERROR_MEMORY          10  /* Memory allocation failed (allocating functions only) */
 
 #ifdef _WIN32
 #  if defined(DLL_EXPORT) || defined(PIC) || defined(_USRDLL)
@@ -103,8 +105,11 @@ extern "C" {
                     U+00A5  ->  0x5C    ->  U+00A5  (U+00A5 YEN SIGN)
  */
 
+/* Bit for `eci` in the mask set by `zueci_utf8_eci_mask()` - ECIs 0-35 use bits 0-35, 170 bit 36 and 899 bit 37 */
+#define ZUECI_ECI_BIT(eci) (1ULL << ((eci) <= 35 ? (eci) : (eci) == 170 ? 36 : 37))
+
 /*
-    If embedding the library (i.e. including the 10 files directly) and only want ECI-to-UTF-8 functionality,
+    If embedding the library (i.e. including the 16 files directly) and only want ECI-to-UTF-8 functionality,
     define `ZUECI_EMBED_NO_TO_ECI`
 */
 #ifndef ZUECI_EMBED_NO_TO_ECI
@@ -118,6 +123,48 @@ extern "C" {
 ZUECI_EXTERN int zueci_utf8_to_eci(const int eci, const unsigned char src[], const int src_len,
                     unsigned char dest[], int *p_dest_len);
 
+/*
+    Set `p_eci_mask` to the ECIs that UTF-8 `src` of length `src_len` can be converted to, i.e. for which
+    `zueci_utf8_to_eci()` would succeed, as a mask of `ZUECI_ECI_BIT(eci)` bits, decoding `src` once only.
+    Much faster than trying `zueci_utf8_to_eci()` with each ECI in turn.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_eci_mask(const unsigned char src[], const int src_len, unsigned long long *p_eci_mask);
+
+/*
+    Set `p_eci` to whichever of the `ecis_len` ECIs `ecis` UTF-8 `src` of length `src_len` converts to in the
+    fewest bytes, and `p_dest_len` to that length (as `zueci_utf8_to_eci()` would give), decoding `src` once only.
+    If more than one gives the fewest bytes, the first in `ecis` is chosen.
+    Returns 0 if successful, ZUECI_ERROR_INVALID_DATA if none can convert `src`, or one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_best_eci(const unsigned char src[], const int src_len, const int ecis[], const int ecis_len,
+                    int *p_eci, int *p_dest_len);
+
+/* A segment of UTF-8 source as set by `zueci_utf8_segment()` */
+typedef struct zueci_segment {
+    int eci;
+    int offset;                     /* Start of segment in UTF-8 source */
+    int length;                     /* Length of segment in UTF-8 source */
+    int dest_len;                   /* Length of segment converted to `eci` (excluding switch cost) */
+} zueci_segment;
+
+/*
+    Split UTF-8 `src` of length `src_len` into segments, each converted to one of the `ecis_len` ECIs `ecis`, so
+    that the total converted length, counting `switch_cost` bytes for each segment (the cost of an ECI
+    designator), is minimal, decoding `src` once only (time proportional to `src_len` times `ecis_len`).
+    `segs` is set to the segments in order, with `p_segs_len` set to their number, and `p_total_len` to the total
+    including switch costs.
+    Scratch requirement: `segs` must have room for an entry per codepoint of `src` (`src_len` entries suffices),
+    i.e. the most segments possible, as it's also used for the per-codepoint back-references needed to trace the
+    segments back, so is overwritten beyond `*p_segs_len`. Other working memory is fixed (per ECI).
+    If choices give the same total, fewer segments are preferred, then ECIs earlier in `ecis`.
+    Returns 0 if successful, ZUECI_ERROR_INVALID_DATA if some character can't be converted by any of `ecis`, or
+    one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_segment(const unsigned char src[], const int src_len, const int ecis[],
+                    const int ecis_len, const int switch_cost, zueci_segment segs[], int *p_segs_len,
+                    int *p_total_len);
+
 /*
     Calculate sufficient (i.e. approx.) length needed to convert UTF-8 `src` of length `len` from UTF-8 to ECI
     `eci`, and place in `p_dest_len`.
@@ -125,6 +172,46 @@ ZUECI_EXTERN int zueci_utf8_to_eci(const int eci, const unsigned char src[], con
  */
 ZUECI_EXTERN int zueci_dest_len_eci(const int eci, const unsigned char src[], const int src_len, int *p_dest_len);
 
+/*
+    Convert `count` UTF-8 strings `srcs[i]` of length `src_lens[i]` to `eci`-encoded `dest` in one call, doing the
+    setup of `zueci_utf8_to_eci()` once only.
+    Item `i` is placed at `dest + dest_offsets[i]`, of length `dest_offsets[i + 1] - dest_offsets[i]` (so
+    `dest_offsets` must have `count + 1` entries), with its status in `rets[i]`, as returned by
+    `zueci_utf8_to_eci()`. Items that fail have zero length.
+    `dest` must be big enough (4-times the total of `src_lens`). It is not NUL-terminated.
+    Returns the highest of `rets` (so 0 if all successful), or one of `ZUECI_ERROR_XXX` if args invalid.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_batch(const int eci, const unsigned char *const srcs[], const int src_lens[],
+                    const int count, unsigned char dest[], int dest_offsets[], int rets[]);
+
+/*
+    As `zueci_utf8_to_eci()` but converting only as much of `src` as fits in `dest` of size `dest_size`, stopping at
+    a character boundary.
+    `p_src_used` is set to the number of bytes of `src` converted, and `p_dest_len` to length of `dest` on output.
+    Returns 0 if all converted, ZUECI_WARN_DEST_FULL if `dest` full before, in which case call again with the rest
+    of `src`, or one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_bounded(const int eci, const unsigned char src[], const int src_len,
+                    unsigned char dest[], const int dest_size, int *p_src_used, int *p_dest_len);
+
+/*
+    As `zueci_utf8_to_eci()` but for large `src`, splitting it at character boundaries into chunks converted in
+    parallel by up to `threads` threads (each chunk at least 64K), placing the results contiguously in `dest`.
+    Converts serially if `threads` is 1 or less, or if the library is built without `ZUECI_THREADS` defined.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not (the first in `src` order if more than one).
+ */
+ZUECI_EXTERN int zueci_utf8_to_eci_mt(const int eci, const unsigned char src[], const int src_len,
+                    unsigned char dest[], int *p_dest_len, const int threads);
+
+/*
+    Set `p_hits` and `p_misses` to the calling thread's counts of lookups in the GBK/GB 18030 encode cache,
+    resetting them after if `reset` set - for tuning `ZUECI_ENCODE_CACHE_BITS` against a corpus.
+    Both are always 0 unless the library is built with `ZUECI_ENCODE_CACHE` defined (and not `ZUECI_BMP_TABLES`).
+    Returns 0 if successful, ZUECI_ERROR_INVALID_ARGS if `p_hits` or `p_misses` NULL.
+ */
+ZUECI_EXTERN int zueci_encode_cache_stats(unsigned long long *p_hits, unsigned long long *p_misses,
+                    const int reset);
+
 #endif /* ZUECI_EMBED_NO_TO_ECI */
 
 /*
@@ -143,7 +230,7 @@ ZUECI_EXTERN int zueci_dest_len_eci(const int eci, const unsigned char src[], co
 #define ZUECI_FLAG_SJIS_STRAIGHT_THRU   2
 
 /*
-    If embedding the library (i.e. including the 10 files directly) and only want UTF-8-to-ECI functionality,
+    If embedding the library (i.e. including the 16 files directly) and only want UTF-8-to-ECI functionality,
     define `ZUECI_EMBED_NO_TO_UTF8`
 */
 #ifndef ZUECI_EMBED_NO_TO_UTF8
@@ -161,8 +248,6 @@ ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], con
                     const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
                     int *p_dest_len);
 
- static int zueci_is_valid_utf8(const unsigned char src[], const int len);
-
 /*
     Calculate exact length needed to convert ECI-encoded `src` of length `len` from ECI `eci`, and place in
     `p_dest_len`.
@@ -171,6 +256,106 @@ ZUECI_EXTERN int zueci_eci_to_utf8(const int eci, const unsigned char src[], con
 ZUECI_EXTERN int zueci_dest_len_utf8(const int eci, const unsigned char src[], const int src_len,
                     const unsigned int replacement_char, const unsigned int flags, int *p_dest_len);
 
+/*
+    Convert `count` ECI-encoded strings `srcs[i]` of length `src_lens[i]` to UTF-8 `dest` in one call, doing the
+    setup of `zueci_eci_to_utf8()` (checking args and encoding `replacement_char`) once only.
+    Item `i` is placed at `dest + dest_offsets[i]`, of length `dest_offsets[i + 1] - dest_offsets[i]` (so
+    `dest_offsets` must have `count + 1` entries), with its status in `rets[i]`, as returned by
+    `zueci_eci_to_utf8()`. Items that fail have zero length.
+    `dest` must be big enough (4-times the total of `src_lens`). It is not NUL-terminated.
+    Returns the highest of `rets` (so 0 if all successful), or one of `ZUECI_ERROR_XXX` if args invalid.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_batch(const int eci, const unsigned char *const srcs[], const int src_lens[],
+                    const int count, const unsigned int replacement_char, const unsigned int flags,
+                    unsigned char dest[], int dest_offsets[], int rets[]);
+
+/*
+    As `zueci_eci_to_utf8()` but converting only as much of `src` as fits in `dest` of size `dest_size`, stopping at
+    a character boundary.
+    `p_src_used` is set to the number of bytes of `src` converted, and `p_dest_len` to length of `dest` on output.
+    Returns 0 if all converted, ZUECI_WARN_INVALID_DATA if replacement character used, ZUECI_WARN_DEST_FULL if
+    `dest` full before (taking precedence), in which case call again with the rest of `src`, or one of
+    `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_bounded(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
+                    const int dest_size, int *p_src_used, int *p_dest_len);
+
+/*
+    Reallocation function for `zueci_eci_to_utf8_alloc()`, with the semantics of `realloc()` except that a `size`
+    of zero must free `ptr` (and return NULL). `ctx` is passed through from the caller.
+ */
+typedef void *(*zueci_realloc_func)(void *ctx, void *ptr, const int size);
+
+/*
+    As `zueci_eci_to_utf8()` but converting in a single pass into `*p_dest`, allocated using `realloc_func` (or
+    `realloc()` if NULL, in which case free with `free()`), which is grown as needed and then shrunk to fit
+    `*p_dest_len` plus one byte, allowing a terminating NUL to be added.
+    Unlike calling `zueci_dest_len_utf8()` followed by `zueci_eci_to_utf8()`, the source is only decoded once.
+    `*p_dest` is only set if successful (including ZUECI_WARN_INVALID_DATA).
+    Returns 0 if successful, ZUECI_WARN_INVALID_DATA if replacement character used, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_alloc(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, zueci_realloc_func realloc_func,
+                    void *ctx, unsigned char **p_dest, int *p_dest_len);
+
+/*
+    As `zueci_eci_to_utf8()` but for large `src`, splitting it into chunks converted in parallel by up to `threads`
+    threads (each chunk at least 64K), placing the results contiguously in `dest`, giving the same result as
+    `zueci_eci_to_utf8()`, replacements included.
+    Chunks are only split where a character must start whatever precedes it, e.g. for double-byte ECIs after an
+    ASCII byte, so data with few such points (e.g. no ASCII) may use fewer threads.
+    Each chunk's exact UTF-8 length is counted first (in parallel), and then each converted straight into its place.
+    `dest` must be big enough (4-times the `src_len`, or see `zueci_dest_len_utf8()`).
+    Converts serially if `threads` is 1 or less, or if the library is built without `ZUECI_THREADS` defined.
+    Returns as `zueci_eci_to_utf8()`.
+ */
+ZUECI_EXTERN int zueci_eci_to_utf8_mt(const int eci, const unsigned char src[], const int src_len,
+                    const unsigned int replacement_char, const unsigned int flags, unsigned char dest[],
+                    int *p_dest_len, const int threads);
+
+/*
+    Streaming state for converting ECI-encoded data arriving in chunks to UTF-8, carrying any multibyte sequence
+    split across chunks. Members are private - set up with `zueci_stream_init()`.
+ */
+typedef struct zueci_stream {
+    int eci;
+    unsigned int replacement_char;
+    unsigned int flags;
+    unsigned int state;             /* ECI 26 UTF-8 decoder state */
+    unsigned int u;                 /* ECI 26 UTF-8 decoder codepoint so far */
+    int skip;                       /* ECI 26 skipping continuation bytes after replacement */
+    unsigned char pending[4];       /* Other ECIs trailing bytes of previous chunk not yet converted */
+    int pending_len;
+} zueci_stream;
+
+/*
+    Initialize `stream` to convert ECI-encoded data from ECI `eci` to UTF-8, with `replacement_char` and `flags`
+    as for `zueci_eci_to_utf8()`.
+    Returns 0 if successful, one of `ZUECI_ERROR_XXX` if not.
+ */
+ZUECI_EXTERN int zueci_stream_init(zueci_stream *stream, const int eci, const unsigned int replacement_char,
+                    const unsigned int flags);
+
+/*
+    Convert the next chunk `src` of length `src_len` to UTF-8 `dest`, holding back any incomplete trailing
+    multibyte sequence until the next call.
+    `p_dest_len` is set to length of `dest` on output.
+    `dest` must be big enough (4-times `src_len` plus 12). It is not NUL-terminated.
+    Returns 0 if successful, ZUECI_WARN_INVALID_DATA if replacement character used in this chunk, or one of
+    `ZUECI_ERROR_XXX` if not, in which case the stream should be discarded.
+ */
+ZUECI_EXTERN int zueci_stream_feed(zueci_stream *stream, const unsigned char src[], const int src_len,
+                    unsigned char dest[], int *p_dest_len);
+
+/*
+    Flush any incomplete sequence held back by `stream` to UTF-8 `dest`, which must be at least 12 bytes, as
+    `zueci_eci_to_utf8()` would at the end of data, and reset `stream` for re-use.
+    `p_dest_len` is set to length of `dest` on output.
+    Returns as `zueci_stream_feed()`.
+ */
+ZUECI_EXTERN int zueci_stream_finish(zueci_stream *stream, unsigned char dest[], int *p_dest_len);
+
 #endif /* ZUECI_EMBED_NO_TO_UTF8 */
 
 #ifdef __cplusplus
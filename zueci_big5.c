@@ -0,0 +1,81 @@
+/*  zueci_big5.c - ECI 28 Big5 Chinese (Taiwan) */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <assert.h>
+
+#include "zueci.h"
+#include "zueci_common.h"
+
+#if ZUECI_HAS_ECI(28)
+#include "zueci_mb.h"
+#include "zueci_big5.h"
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Unicode to ECI 28 Big5 Chinese (Taiwan) */
+ZUECI_INTERN int zueci_u_big5(const zueci_u32 u, unsigned char *dest) {
+    if (u < 0x80) {
+        dest[0] = (unsigned char) u;
+        return 1;
+    }
+    /* Special case URO block sequential mappings (considerably lessens size of `zueci_big5_pg_mb[]` array) */
+    if (u >= 0x4E00 && u < 0xFA0C) { /* 0xFA0C next used value >= 0x4E00 */
+        if (u >= 0x9FB0) {
+            return 0;
+        }
+        return zueci_u_lookup_uro(u, zueci_big5_uro_rs, zueci_big5_u_mb, dest);
+    }
+    return zueci_u_lookup_pg(u, zueci_big5_pg_dir, zueci_big5_pg, zueci_big5_pg_mb, dest);
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_big5_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_big5(u, dest);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* ECI 28 Big5 to Unicode */
+ZUECI_INTERN int zueci_big5_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2;
+    int ind;
+    zueci_u32 u2;
+
+    (void)flags;
+    assert(len);
+
+    c1 = src[0];
+    if (c1 < 0x80) {
+        *p_u = c1;
+        return 1;
+    }
+    if (len < 2 || c1 < 0xA1 || c1 == 0xC8 || c1 > 0xF9) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 < 0x40 || (c2 > 0x7E && c2 < 0xA1) || c2 == 0xFF) {
+        return 0;
+    }
+    ind = 0x9D * (c1 - 0xA1 - (c1 > 0xC8)) + c2 - 0x40 - (c2 > 0x7E) * (0xA1 - 0x7F);
+    if (ind < ZUECI_ASIZE(zueci_big5_mb_u) && (u2 = zueci_big5_mb_u[ind])) {
+        *p_u = u2;
+        return 2;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_big5_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_big5_u(src, len, flags, p_u);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+#endif /* ZUECI_HAS_ECI(28) */
+
+/* vim: set ts=4 sw=4 et : */
@@ -27,5 +27,93 @@ typedef unsigned int zueci_u32;
 
 typedef char zueci_static_assert_u32_at_least_32bits[sizeof(zueci_u32) < 4 ? -1 : 1];
 
+/* Put 4 bytes into `zueci_u32` */
+#define ZUECI_4BYTES_U32(c1, c2, c3, c4) \
+    (((zueci_u32) (c1) << 24) | ((zueci_u32) (c2) << 16) | ((zueci_u32) (c3) << 8) | (c4))
+
+/* ECIs built, as a mask of `ZUECI_ECI_BIT()` bits - all unless `ZUECI_ECIS_MASK` defined (CMake option `ZUECI_ECIS`),
+   in which case the others are invalid and their tables left out */
+#ifdef ZUECI_ECIS_MASK
+#  define ZUECI_ECIS_BUILT (ZUECI_ECIS_MASK)
+#else
+#  define ZUECI_ECIS_BUILT (~0ULL)
+#endif
+/* Whether `eci` built (usable in `#if`) */
+#define ZUECI_HAS_ECI(eci) ((ZUECI_ECIS_BUILT & ZUECI_ECI_BIT(eci)) != 0)
+
+/* Multibyte codecs in their own translation units, aliased to the never called `zueci_u_none()` and `zueci_none_u()`
+   in "zueci.c" if not built */
+#ifndef ZUECI_EMBED_NO_TO_ECI
+#if ZUECI_HAS_ECI(20)
+ZUECI_INTERN int zueci_u_sjis(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_sjis zueci_u_none
+#endif
+#if ZUECI_HAS_ECI(28)
+ZUECI_INTERN int zueci_u_big5(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_big5 zueci_u_none
+#endif
+#if ZUECI_HAS_ECI(29) || ZUECI_HAS_ECI(31) || ZUECI_HAS_ECI(32) /* Used by GBK and GB 18030 also */
+ZUECI_INTERN int zueci_u_gb2312(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_gb2312 zueci_u_none
+#endif
+#if ZUECI_HAS_ECI(30)
+ZUECI_INTERN int zueci_u_ksx1001(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_ksx1001 zueci_u_none
+#endif
+#if ZUECI_HAS_ECI(31)
+ZUECI_INTERN int zueci_u_gbk(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_gbk zueci_u_none
+#endif
+#if ZUECI_HAS_ECI(32)
+ZUECI_INTERN int zueci_u_gb18030(const zueci_u32 u, unsigned char *dest);
+#else
+#  define zueci_u_gb18030 zueci_u_none
+#endif
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+#if ZUECI_HAS_ECI(20)
+ZUECI_INTERN int zueci_sjis_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_sjis_u zueci_none_u
+#endif
+#if ZUECI_HAS_ECI(28)
+ZUECI_INTERN int zueci_big5_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_big5_u zueci_none_u
+#endif
+#if ZUECI_HAS_ECI(29)
+ZUECI_INTERN int zueci_gb2312_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_gb2312_u zueci_none_u
+#endif
+#if ZUECI_HAS_ECI(30)
+ZUECI_INTERN int zueci_ksx1001_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_ksx1001_u zueci_none_u
+#endif
+#if ZUECI_HAS_ECI(31)
+ZUECI_INTERN int zueci_gbk_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_gbk_u zueci_none_u
+#endif
+#if ZUECI_HAS_ECI(32)
+ZUECI_INTERN int zueci_gb18030_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u);
+#else
+#  define zueci_gb18030_u zueci_none_u
+#endif
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+
 /* vim: set ts=4 sw=4 et : */
 #endif /* ZUECI_COMMON_H */
@@ -0,0 +1,342 @@
+/*  zueci_gb18030.c - ECIs 31 GBK and 32 GB 18030 Chinese */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <assert.h>
+
+#include "zueci.h"
+#include "zueci_common.h"
+
+#if ZUECI_HAS_ECI(31) || ZUECI_HAS_ECI(32) /* GBK shares the GB 18030 class map, and GB 18030 the GBK tables */
+#include "zueci_mb.h"
+#include "zueci_gb18030.h"
+#include "zueci_gbk.h"
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* GB 18030 class of BMP codepoint `u`: 0 1-byte, 1 2-byte as GB 2312, 2 other 2-byte, 3 4-byte */
+#define ZUECI_GB18030_CLS(u) ((zueci_gb18030_cls[(u) >> 2] >> (((u) & 3) << 1)) & 3)
+
+/* Helper to lookup BMP codepoint `u` of GB 18030 class 2 in GBK (excl. GB 2312) */
+static int zueci_u_gbk_only(const zueci_u32 u, unsigned char *dest) {
+    if (u == 0x2015) {
+        /* HORIZONTAL BAR, mapped to 0xA844 by GBK rather than 0xA1AA (U+2014 EM DASH mapped there instead) */
+        dest[0] = 0xA8;
+        dest[1] = 0x44;
+        return 2;
+    }
+
+    /* Special case URO block sequential mappings (considerably lessens size of `zueci_gbk_pg_mb[]` array) */
+    if (u >= 0x4E00 && u < 0xF92C) { /* 0xF92C next used value >= 0x4E00 */
+        if (u >= 0x9FB0) {
+            return 0;
+        }
+        return zueci_u_lookup_uro(u, zueci_gbk_uro_rs, zueci_gbk_u_mb, dest);
+    }
+    return zueci_u_lookup_pg(u, zueci_gbk_pg_dir, zueci_gbk_pg, zueci_gbk_pg_mb, dest);
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#if !defined(ZUECI_EMBED_NO_TO_ECI) && ZUECI_HAS_ECI(31)
+/* Unicode to ECI 31 GBK Chinese */
+ZUECI_INTERN int zueci_u_gbk(const zueci_u32 u, unsigned char *dest) {
+    int cls;
+
+    if (u < 0x80) {
+        *dest = (unsigned char) u;
+        return 1;
+    }
+    if (u > 0xFFFF) {
+        return 0;
+    }
+
+    /* Route by GB 18030 class, which is GB 2312 only if mapped the same by GBK, so excludes U+30FB KATAKANA MIDDLE
+       DOT (U+00B7 MIDDLE DOT mapped to 0xA1A4 instead by GBK) and U+2015 HORIZONTAL BAR */
+    if ((cls = ZUECI_GB18030_CLS(u)) == 1) {
+        /* Includes the 2 GB 6345.1-86 corrections given in Table 3-22, Lunde, 2nd ed. */
+        return zueci_u_gb2312(u, dest);
+    }
+    if (cls == 2) {
+        return zueci_u_gbk_only(u, dest);
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_gbk_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_gbk(u, dest);
+}
+#endif
+#endif /* !ZUECI_EMBED_NO_TO_ECI && ZUECI_HAS_ECI(31) */
+
+#if !defined(ZUECI_EMBED_NO_TO_UTF8) && ZUECI_HAS_ECI(31)
+/* ECI 31 GBK Chinese to Unicode */
+ZUECI_INTERN int zueci_gbk_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2;
+    zueci_u32 u2;
+
+    (void)flags;
+    assert(len);
+
+    c1 = src[0];
+    if (c1 < 0x80) {
+        *p_u = c1;
+        return 1;
+    }
+    if (len < 2 || c1 < 0x81 || c1 == 0xFF) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 < 0x40 || c2 == 0xFF) {
+        return 0;
+    }
+    /* Dense table includes GB 2312 with GBK's MIDDLE DOT 0xA1A4 and EM DASH 0xA1AA (0 for 0x7F trail bytes) */
+    if ((u2 = zueci_gbk_mb2_u[(c1 - 0x81) * 191 + c2 - 0x40])) {
+        *p_u = u2;
+        return 2;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_gbk_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_gbk_u(src, len, flags, p_u);
+}
+#endif
+#endif /* !ZUECI_EMBED_NO_TO_UTF8 && ZUECI_HAS_ECI(31) */
+
+#if !defined(ZUECI_EMBED_NO_TO_ECI) && ZUECI_HAS_ECI(32)
+/* Helper for `u_gb18030()` to output 4-byte sequential blocks 0x[81-FE][30-39][81-FE][30-39] */
+static int zueci_u_gb18030_4_sequential(zueci_u32 u2, zueci_u32 mb_lead, unsigned char *dest) {
+    zueci_u32 dv;
+
+    dv = u2 / 10; /* (0x39 - 0x30) + 1 */
+    dest[3] = (unsigned char) (u2 - dv * 10 + 0x30);
+    u2 = dv;
+    dv = u2 / 126; /* (0xFE - 0x81) + 1 */
+    dest[2] = (unsigned char) (u2 - dv * 126 + 0x81);
+    u2 = dv;
+    dv = u2 / 10; /* (0x39 - 0x30) + 1 */
+    dest[0] = (unsigned char) (dv + mb_lead);
+    dest[1] = (unsigned char) (u2 - dv * 10 + 0x30);
+    return 4;
+}
+
+/* Unicode to ECI 32 GB 18030 Chinese - assumes valid Unicode */
+ZUECI_INTERN int zueci_u_gb18030(const zueci_u32 u, unsigned char *dest) {
+    zueci_u32 u2, dv;
+    int s, cls;
+
+    if (u < 0x80) {
+        *dest = (unsigned char) u;
+        return 1;
+    }
+
+    if (u >= 0x10000) {
+        /* Non-BMP that were PUA, see Table 3-37, Lunde, 2nd ed. */
+        if (u == 0x20087) {
+            dest[0] = 0xFE;
+            dest[1] = 0x51;
+            return 2;
+        }
+        if (u == 0x20089) {
+            dest[0] = 0xFE;
+            dest[1] = 0x52;
+            return 2;
+        }
+        if (u == 0x200CC) {
+            dest[0] = 0xFE;
+            dest[1] = 0x53;
+            return 2;
+        }
+        if (u == 0x215D7) {
+            dest[0] = 0xFE;
+            dest[1] = 0x6C;
+            return 2;
+        }
+        if (u == 0x2298F) {
+            dest[0] = 0xFE;
+            dest[1] = 0x76;
+            return 2;
+        }
+        if (u == 0x241FE) {
+            dest[0] = 0xFE;
+            dest[1] = 0x91;
+            return 2;
+        }
+        /* All other non-BMP U+10000-10FFFF */
+        return zueci_u_gb18030_4_sequential(u - 0x10000, 0x90, dest);
+    }
+
+    /* Route by class, going straight to 4-byte ones (the bulk of BMP) without trying the 2-byte lookups first */
+    if ((cls = ZUECI_GB18030_CLS(u)) == 1) {
+        return zueci_u_gb2312(u, dest);
+    }
+    if (cls == 2) {
+        if (zueci_u_gbk_only(u, dest)) {
+            return 2;
+        }
+        if (u >= 0xE000 && u <= 0xE765) { /* PUA to user-defined */
+            if (u <= 0xE4C5) {
+                u2 = u - 0xE000;
+                dv = u2 / 94;
+                dest[0] = (unsigned char) (dv + (dv < 6 ? 0xAA : 0xF2));
+                dest[1] = (unsigned char) (u2 - dv * 94 + 0xA1);
+            } else {
+                zueci_u32 md;
+                u2 = u - 0xE4C6;
+                dv = u2 / 96;
+                md = u2 - dv * 96;
+                dest[0] = (unsigned char) (dv + 0xA1);
+                dest[1] = (unsigned char) (md + 0x40 + (md >= 0x3F));
+            }
+            return 2;
+        }
+        s = ZUECI_GB18030_PHASH(u, zueci_gb18030_2_u_d, ZUECI_ASIZE(zueci_gb18030_2_u_u));
+        if (zueci_gb18030_2_u_u[s] == u) {
+            const zueci_u16 mb = zueci_gb18030_2_u_mb[s];
+            dest[0] = (unsigned char) (mb >> 8);
+            dest[1] = (unsigned char) mb;
+            return 2;
+        }
+    }
+
+    /* All other BMP U+0080-FFFF */
+    if (u == 0xE7C7) { /* PUA change to non-PUA, see Table 3-39, Lunde, 2nd ed. */
+        dest[0] = 0x81;
+        dest[1] = 0x35;
+        dest[2] = 0xF4;
+        dest[3] = 0x37;
+        return 4;
+    }
+    /* Bucket index gives block or block before */
+    s = zueci_gb18030_4_u_ind[u >> 7];
+    if (s >= 0x100) {
+        s = zueci_gb18030_4_u_ind2[((s - 0x100) << 6) | ((u >> 1) & 0x3F)];
+    }
+    if (zueci_gb18030_4_u_e[s] < u) {
+        s++;
+    }
+    assert(s < ZUECI_ASIZE(zueci_gb18030_4_u_e));
+    return zueci_u_gb18030_4_sequential(u - zueci_gb18030_4_u_mb_o[s] - 0x80, 0x81, dest);
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_gb18030_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_gb18030(u, dest);
+}
+#endif
+#endif /* !ZUECI_EMBED_NO_TO_ECI && ZUECI_HAS_ECI(32) */
+
+#if !defined(ZUECI_EMBED_NO_TO_UTF8) && ZUECI_HAS_ECI(32)
+/* Helper to convert GB 18030 4-byter to linear offset */
+static zueci_u32 zueci_gb18030_mb4_u(zueci_u32 mb4) {
+    unsigned char c1 = (unsigned char) (mb4 >> 24);
+    unsigned char c2 = (unsigned char) (mb4 >> 16);
+    unsigned char c3 = (unsigned char) (mb4 >> 8);
+    unsigned char c4 = (unsigned char) mb4;
+
+    return (((c1 - 0x81) * 10 + (c2 - 0x30)) * 126 + (c3 - 0x81)) * 10 + c4 - 0x30;
+}
+
+/* ECI 32 GB 18030 to Unicode */
+ZUECI_INTERN int zueci_gb18030_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2, c3, c4;
+    zueci_u32 u2;
+    zueci_u32 mb4;
+
+    (void)flags;
+    assert(len);
+
+    c1 = src[0];
+    if (c1 < 0x80) {
+        *p_u = c1;
+        return 1;
+    }
+    if (len < 2 || c1 < 0x81 || c1 == 0xFF) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 >= 0x40 && c2 != 0xFF) {
+        /* Dense table includes GBK and the user-defined PUA (0 for 0x7F trail bytes and the non-BMP below) */
+        if ((u2 = zueci_gb18030_mb2_u[(c1 - 0x81) * 191 + c2 - 0x40])) {
+            *p_u = u2;
+            return 2;
+        }
+        if (c1 == 0xFE) {
+            /* Non-BMP that were PUA, see Table 3-37, Lunde, 2nd ed. */
+            if (c2 == 0x51) {
+                *p_u = 0x20087;
+                return 2;
+            }
+            if (c2 == 0x52) {
+                *p_u = 0x20089;
+                return 2;
+            }
+            if (c2 == 0x53) {
+                *p_u = 0x200CC;
+                return 2;
+            }
+            if (c2 == 0x6C) {
+                *p_u = 0x215D7;
+                return 2;
+            }
+            if (c2 == 0x76) {
+                *p_u = 0x2298F;
+                return 2;
+            }
+            if (c2 == 0x91) {
+                *p_u = 0x241FE;
+                return 2;
+            }
+        }
+        return 0;
+    }
+    if (len >= 4 && c2 <= 0x39 && c2 >= 0x30 && c1 >= 0x81 && c1 <= 0xE3) {
+        c3 = src[2];
+        c4 = src[3];
+        mb4 = ZUECI_4BYTES_U32(c1, c2, c3, c4);
+        if (mb4 < 0x81308130 || (mb4 > 0x8431A439 && mb4 < 0x90308130) || mb4 > 0xE3329A35
+                || c3 < 0x81 || c3 > 0xFE || c4 < 0x30 || c4 > 0x39) {
+            return 0;
+        }
+        if (mb4 == 0x8135F437) { /* PUA change to non-PUA, see Table 3-39, Lunde, 2nd ed. */
+            *p_u = 0xE7C7;
+            return 4;
+        }
+        if (c1 >= 0x90) { /* Non-BMP */
+            *p_u = 0x10000 + (((c1 - 0x90) * 10 + (c2 - 0x30)) * 126 + (c3 - 0x81)) * 10 + c4 - 0x30;
+        } else { /* BMP */
+            /* Linear offsets of consecutive blocks are contiguous, so bucket index gives block or block before */
+            const zueci_u32 lin = zueci_gb18030_mb4_u(mb4);
+            int s = zueci_gb18030_4_mb_ind[lin >> 7];
+            if (s >= 0x100) {
+                s = zueci_gb18030_4_mb_ind2[((s - 0x100) << 6) | ((lin >> 1) & 0x3F)];
+            }
+            if ((zueci_u32) (zueci_gb18030_4_u_e[s] - zueci_gb18030_4_u_mb_o[s] - 0x80) < lin) {
+                s++;
+            }
+            assert(s < ZUECI_ASIZE(zueci_gb18030_4_u_e));
+            *p_u = lin + zueci_gb18030_4_u_mb_o[s] + 0x80;
+        }
+        return 4;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_gb18030_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_gb18030_u(src, len, flags, p_u);
+}
+#endif
+#endif /* !ZUECI_EMBED_NO_TO_UTF8 && ZUECI_HAS_ECI(32) */
+
+#endif /* ZUECI_HAS_ECI(31) || ZUECI_HAS_ECI(32) */
+
+/* vim: set ts=4 sw=4 et : */
@@ -0,0 +1,83 @@
+/*  zueci_gb2312.c - ECI 29 GB 2312 Chinese (PRC) */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <assert.h>
+
+#include "zueci.h"
+#include "zueci_common.h"
+
+#if ZUECI_HAS_ECI(29) || ZUECI_HAS_ECI(31) || ZUECI_HAS_ECI(32) /* Unicode to GB 2312 used by GBK and GB 18030 also */
+#include "zueci_mb.h"
+#include "zueci_gb2312.h"
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Unicode to ECI 29 GB 2312 Chinese (PRC) */
+ZUECI_INTERN int zueci_u_gb2312(const zueci_u32 u, unsigned char *dest) {
+
+    if (u < 0x80) {
+        dest[0] = u;
+        return 1;
+    }
+    /* Special case URO block sequential mappings (considerably lessens size of `zueci_gb2312_pg_mb[]` array) */
+    if (u >= 0x4E00 && u < 0x9E1F) { /* 0x9E1F next used non-sequential value >= 0x4E00 */
+        if (u >= 0x9CF0) {
+            return 0;
+        }
+        return zueci_u_lookup_uro(u, zueci_gb2312_uro_rs, zueci_gb2312_u_mb, dest);
+    }
+    return zueci_u_lookup_pg(u, zueci_gb2312_pg_dir, zueci_gb2312_pg, zueci_gb2312_pg_mb, dest);
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_gb2312_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_gb2312(u, dest);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#if !defined(ZUECI_EMBED_NO_TO_UTF8) && ZUECI_HAS_ECI(29)
+/* ECI 29 GB 2312 to Unicode */
+ZUECI_INTERN int zueci_gb2312_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2;
+    int ind;
+    zueci_u32 u2;
+
+    (void)flags;
+    assert(len);
+
+    c1 = src[0];
+    if (c1 < 0x80) {
+        *p_u = c1;
+        return 1;
+    }
+    if (len < 2 || c1 < 0xA1 || (c1 > 0xA9 && c1 < 0xB0) || c1 > 0xF7) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 < 0xA1 || c2 == 0xFF) {
+        return 0;
+    }
+    ind = (0xFF - 0xA1) * (c1 - 0xA1 - (c1 > 0xA9) * (0xB0 - 0xAA)) + c2 - 0xA1;
+    assert(ind < ZUECI_ASIZE(zueci_gb2312_mb_u));
+    if ((u2 = zueci_gb2312_mb_u[ind])) {
+        *p_u = u2;
+        return 2;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_gb2312_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_gb2312_u(src, len, flags, p_u);
+}
+#endif
+#endif /* !ZUECI_EMBED_NO_TO_UTF8 && ZUECI_HAS_ECI(29) */
+#endif /* ZUECI_HAS_ECI(29) || ZUECI_HAS_ECI(31) || ZUECI_HAS_ECI(32) */
+
+/* vim: set ts=4 sw=4 et : */
@@ -11,516 +11,121 @@
 #define ZUECI_GB2312_H
 
 #ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode usage bit-flags for URO (U+4E00-U+9FFF) block */
-static const zueci_u16 zueci_gb2312_uro_u[1263] = {
-    0x7F8B, 0x7F7B, 0x3DB4, 0xEF55, 0xFBA8, 0xF35D, 0x0243, 0x400B,
-    0xFB40, 0x8D3E, 0x7BF7, 0x8C2C, 0x6EFF, 0xE3FA, 0x1D3A, 0xA8ED,
-    0xE602, 0xCF83, 0x8CF5, 0x3555, 0xE048, 0xFFAB, 0x92B9, 0xD859,
-    0xAB18, 0x2892, 0xD7E9, 0x8020, 0xC438, 0xF583, 0xE74A, 0x450A,
-    0xB000, 0x9714, 0x7762, 0x5400, 0xD188, 0x1420, 0x1020, 0xC8C0,
-    0x2121, 0x0000, 0x13A8, 0x0C04, 0x8000, 0x0440, 0x70C0, 0x0828,
-    0x08C0, 0x0004, 0x0002, 0x8000, 0x2B7B, 0x1472, 0x7924, 0x3BFB,
-    0x3327, 0x1AE4, 0x9835, 0x38EF, 0x9AD1, 0x2802, 0xA813, 0xBF69,
-    0x65CF, 0x2FC6, 0x6B11, 0xAFC9, 0x340F, 0x5053, 0x86A2, 0xA004,
-    0x0106, 0xE809, 0x3F0F, 0xC00E, 0x0A88, 0x8145, 0x0010, 0xC601,
-    0xA161, 0x26E1, 0x444B, 0xCE00, 0xC7AA, 0xD4EE, 0xCADF, 0x85BB,
-    0x3A74, 0xA520, 0x436C, 0x8840, 0x3F06, 0x8BD2, 0xFF79, 0x3BEF,
-    0xF75A, 0xE8EF, 0xFBCB, 0x5B36, 0x0D49, 0x1BFD, 0x0154, 0x39EE,
-    0xD855, 0x2E75, 0xBFD8, 0xA91A, 0xF3D7, 0xF6BF, 0x67E0, 0xB40C,
-    0x82C2, 0x0813, 0xD49D, 0xD08B, 0x065A, 0x1061, 0x74F2, 0x59E0,
-    0x8F9F, 0xB312, 0x0080, 0x6AAA, 0x3230, 0xB05E, 0x9D7A, 0x60AC,
-    0xD303, 0xC900, 0x3098, 0x8A56, 0x7000, 0x1390, 0x1F14, 0x1842,
-    0xC060, 0x0008, 0x8008, 0x1080, 0x0400, 0xEC90, 0x2817, 0xE633,
-    0x0758, 0x9000, 0xF708, 0x4E09, 0xF485, 0xFC83, 0xAF53, 0x18C8,
-    0x187C, 0x080C, 0x6ADF, 0x0114, 0xC80C, 0xA734, 0xA011, 0x2710,
-    0x28C5, 0x4222, 0x0413, 0x0021, 0x3010, 0x4112, 0x1820, 0x4000,
-    0x022B, 0xC60C, 0x0300, 0x1000, 0x0022, 0x0022, 0x5810, 0x0249,
-    0xA094, 0x9670, 0xEEB0, 0x1792, 0xCB96, 0x05F2, 0x0025, 0x2358,
-    0x25DE, 0x42CC, 0xCF38, 0x4A04, 0x0C40, 0x359F, 0x1128, 0x8A00,
-    0x13FA, 0x910A, 0x0229, 0x1056, 0x0641, 0x0420, 0x0484, 0x84F0,
-    0x0000, 0x0C04, 0x0400, 0x412C, 0x1206, 0x1154, 0x0A4B, 0x0002,
-    0x0200, 0x00C0, 0x0000, 0x0094, 0x0001, 0xBFBB, 0x167C, 0x242B,
-    0x9BBB, 0x7FA8, 0x0C7F, 0xE379, 0x10F4, 0xE00D, 0x4132, 0x9F01,
-    0x8652, 0x3572, 0x10B4, 0xFF12, 0xCF27, 0x4223, 0xC06B, 0x8602,
-    0x3106, 0x1FD3, 0x3A0C, 0xA1AA, 0x0812, 0x0204, 0x2572, 0x0801,
-    0x40CC, 0x4850, 0x62D0, 0x6010, 0x1C80, 0x2900, 0x9A00, 0x0010,
-    0x0004, 0x2200, 0x0000, 0x0080, 0x2020, 0x6800, 0xCBE6, 0x609E,
-    0x916E, 0x3F73, 0x60C0, 0x3982, 0x1034, 0x4830, 0x0006, 0xBD5C,
-    0x8CD1, 0xD6FB, 0x20E1, 0x43E8, 0x0600, 0x084E, 0x0500, 0xC4D0,
-    0x8D1F, 0x89AA, 0xA6E1, 0x1602, 0x0001, 0x21ED, 0x3656, 0x1A8B,
-    0x1FB7, 0x13A5, 0x6502, 0x30A0, 0xB278, 0x23C7, 0x6C93, 0xE922,
-    0xE47F, 0x3A74, 0x8FE3, 0x9820, 0x280E, 0x2625, 0xBF9C, 0xBF49,
-    0x3218, 0xAC54, 0xB949, 0x1916, 0x0C60, 0xB522, 0xFBC1, 0x0659,
-    0xE343, 0x8420, 0x08D9, 0x8000, 0x5500, 0x2022, 0x0184, 0x00A1,
-    0x4800, 0x2010, 0x1380, 0x4080, 0x0D04, 0x0016, 0x0040, 0x8020,
-    0xFD40, 0x8DE7, 0x5436, 0xE098, 0x7B8B, 0x091E, 0xFEC8, 0xD249,
-    0x0611, 0x8DEE, 0x1937, 0xBA22, 0x77F4, 0x9FDD, 0xF3EC, 0xF0DA,
-    0x4386, 0xEC42, 0x8D3F, 0x2604, 0xFA6C, 0xC021, 0x628E, 0x0CC2,
-    0xD785, 0x0145, 0x77AD, 0x5599, 0xE250, 0x4045, 0x260B, 0xA154,
-    0x9827, 0x5819, 0x3443, 0xA410, 0x05F2, 0x4114, 0x2280, 0x0700,
-    0x00B4, 0x4266, 0x7210, 0x15A1, 0x6025, 0x4185, 0x0054, 0x0000,
-    0x0201, 0x0104, 0xC820, 0xCB70, 0x9320, 0x6A62, 0x184C, 0x0095,
-    0x1880, 0x9A8B, 0xAAB2, 0x3201, 0xD87A, 0x00C4, 0xF3E5, 0x04C3,
-    0xD44D, 0xA238, 0xA1A1, 0x5072, 0x980A, 0x84FC, 0xC152, 0x44D1,
-    0x1094, 0x20C2, 0x4180, 0x4210, 0x0000, 0x3A00, 0x0240, 0xD29D,
-    0x2F01, 0xA8B1, 0xBD40, 0x2432, 0xD34D, 0xD04B, 0xA723, 0xD0AD,
-    0x0A92, 0x75A1, 0xADAC, 0x01E9, 0x801A, 0x771F, 0x9225, 0xA01B,
-    0xDFA1, 0x20CA, 0x0602, 0x738C, 0x577F, 0x003B, 0x0BFF, 0x00D0,
-    0x806A, 0x0088, 0xA1C4, 0x0029, 0x2A05, 0x0524, 0x4009, 0x1623,
-    0x6822, 0x8005, 0x2011, 0xA211, 0x0004, 0x6490, 0x4849, 0x1382,
-    0x23D5, 0x1930, 0x2980, 0x0892, 0x5402, 0x8811, 0x2001, 0xA004,
-    0x0400, 0x8180, 0x8502, 0x6022, 0x0090, 0x0B01, 0x0022, 0x1202,
-    0x4011, 0x0083, 0x1A01, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x009F, 0x4684, 0x12C8, 0x0200, 0x04FC, 0x1A00,
-    0x2EDE, 0x0C4C, 0x0402, 0x80B8, 0xA826, 0x0AFC, 0x8C02, 0x2228,
-    0xA0E0, 0x8F7B, 0xC7D6, 0x2135, 0x06C7, 0xF8B1, 0x0713, 0x6255,
-    0x936E, 0x8A19, 0x6EFA, 0xFB0E, 0x1630, 0x48F9, 0xCD2F, 0x7DEB,
-    0x5892, 0x4E84, 0x4CA0, 0x7A2E, 0xEDEA, 0x561E, 0xC649, 0x1190,
-    0x5324, 0xE83A, 0xCFDB, 0x8124, 0x18F1, 0x6342, 0x5853, 0x1A8A,
-    0x7420, 0x24D3, 0xAA3B, 0x0514, 0x6018, 0x8958, 0x4800, 0xC000,
-    0x8268, 0x9101, 0x84A4, 0x2CD6, 0x8886, 0xC4BA, 0x0377, 0x0210,
-    0x8244, 0x0038, 0xAE11, 0x404A, 0x28C0, 0x5100, 0x6044, 0x1514,
-    0x7310, 0x1000, 0x0082, 0x0248, 0x0205, 0x4006, 0xC003, 0x0000,
-    0x0000, 0x0C02, 0x0008, 0x0220, 0x9000, 0x4000, 0xB800, 0xD161,
-    0x4621, 0x3274, 0xF800, 0x3B8A, 0x050F, 0x8B00, 0xBBD0, 0x2280,
-    0x0600, 0x0769, 0x8040, 0x0043, 0x5420, 0x5000, 0x41D0, 0x250C,
-    0x8410, 0x8310, 0x1101, 0x0228, 0x4008, 0x0030, 0x40A1, 0x0200,
-    0x0040, 0x2000, 0x1500, 0xABE3, 0x3180, 0xAA44, 0xC2C6, 0xC624,
-    0xAC13, 0x8004, 0xB000, 0x03D1, 0x611E, 0x4285, 0xF303, 0x1D9F,
-    0x440A, 0x78E8, 0x5E26, 0xC392, 0x2000, 0x0085, 0xB001, 0x4000,
-    0x4A90, 0x8842, 0xCA04, 0x0C8D, 0xA705, 0x4203, 0x22A1, 0x0004,
-    0x8668, 0x0C01, 0x5564, 0x1079, 0x0002, 0xDEA0, 0x2000, 0x40C1,
-    0x488B, 0x5001, 0x0380, 0x0400, 0x0000, 0x5004, 0xC05D, 0x80D0,
-    0xA010, 0x970A, 0xBB20, 0x4DAF, 0xD921, 0x1E10, 0x0460, 0x8314,
-    0x8848, 0xA6D6, 0xD83B, 0x733F, 0x27BC, 0x4974, 0x0DDC, 0x9213,
-    0x142B, 0x8BA1, 0x2E75, 0xD139, 0x3009, 0x5050, 0x8808, 0x6900,
-    0x49D4, 0x024A, 0x4010, 0x8016, 0xE564, 0x89D7, 0xC020, 0x5316,
-    0x2B92, 0x8600, 0xA345, 0x15E0, 0x008B, 0x0C03, 0x196E, 0xE200,
-    0x7031, 0x8006, 0x16A5, 0xA829, 0x2000, 0x1880, 0x7AAC, 0xE148,
-    0x3207, 0xB5D6, 0x32E8, 0x5F91, 0x50A1, 0x20E5, 0x7C00, 0x1080,
-    0x7280, 0x9D8A, 0x00AA, 0x421F, 0x0E22, 0x0231, 0x1100, 0x0494,
-    0x0022, 0x4008, 0x0010, 0x5C10, 0x0343, 0xFCC8, 0xA1A5, 0x0580,
-    0x8433, 0x0400, 0x0080, 0x6E08, 0x2A4B, 0x8126, 0xAAD8, 0x2901,
-    0x684D, 0x4490, 0x0009, 0xBA88, 0x0040, 0x0082, 0x0000, 0x87D1,
-    0x215B, 0xB1E6, 0x3161, 0x8008, 0x0800, 0xC240, 0xA069, 0xA600,
-    0x8D58, 0x4A32, 0x5D71, 0x550A, 0x9AA0, 0x2D57, 0x4005, 0x4AA6,
-    0x2021, 0x30B1, 0x3FC6, 0x0112, 0x10C2, 0x260A, 0x4462, 0x5082,
-    0x9880, 0x8040, 0x04C0, 0x8100, 0x2003, 0x0000, 0x0000, 0x3818,
-    0x0200, 0xF1A6, 0x4434, 0x720E, 0x35A2, 0x92E0, 0x8101, 0x0900,
-    0x0400, 0x0000, 0x8885, 0x0000, 0x0000, 0x0000, 0x4000, 0x0080,
-    0x0000, 0x0000, 0x4040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0800, 0x0082, 0x0000, 0x0000, 0x0000,
-    0x0004, 0x8800, 0xBFFF, 0xE7EF, 0xFFFF, 0xFFBF, 0xEFEF, 0xFDFF,
-    0xFBFF, 0xBFFE, 0xFFFF, 0x057F, 0x0034, 0x85B3, 0x4706, 0x4216,
-    0x5402, 0xE410, 0x8092, 0xB305, 0x5422, 0x8130, 0x4263, 0x180B,
-    0x387B, 0x13F5, 0x07E5, 0xA9EA, 0x3C4C, 0x0514, 0x0600, 0x8002,
-    0x1AD9, 0xBD48, 0xEE37, 0xF496, 0x705F, 0x7EC0, 0xBFB2, 0x355F,
-    0xE644, 0x455F, 0x9000, 0x4146, 0x1D40, 0x063B, 0x62A1, 0xFE13,
-    0x8505, 0x3902, 0x0548, 0x0C08, 0x144F, 0x0000, 0x3488, 0x5818,
-    0x3077, 0xD815, 0xBD0E, 0x4BFB, 0x8A90, 0x8500, 0xC100, 0xE61D,
-    0xED14, 0xB386, 0xFF72, 0x639B, 0xFD92, 0xD9BE, 0x887B, 0x0A92,
-    0xD3FE, 0x1CB2, 0xB980, 0x177A, 0x82C9, 0xDC17, 0xFFFB, 0x3980,
-    0x4260, 0x590C, 0x0F01, 0x37DF, 0x94A3, 0xB150, 0x0623, 0x2307,
-    0xF85A, 0x3102, 0x01F0, 0x3102, 0x0040, 0x1E82, 0x3A0A, 0x056A,
-    0x5B84, 0x1280, 0x8002, 0xA714, 0x2612, 0xA04B, 0x1069, 0x9001,
-    0x1000, 0x848A, 0x1802, 0x3F80, 0x0708, 0x4240, 0x0110, 0x4E14,
-    0x80B0, 0x1800, 0xC510, 0x0281, 0x8202, 0x1029, 0x0210, 0x8800,
-    0x0020, 0x0042, 0x0280, 0x1100, 0xE000, 0x4413, 0x5804, 0xFE02,
-    0x3C07, 0x3028, 0x9798, 0x0473, 0xCED1, 0xCB13, 0x6210, 0x431F,
-    0x278D, 0x55AC, 0x422E, 0xC892, 0x5380, 0x0288, 0x4039, 0x7851,
-    0x292C, 0x8088, 0xB900, 0x2428, 0x0C41, 0x080E, 0x4421, 0x4200,
-    0x0408, 0x0868, 0x0006, 0x1204, 0x3031, 0x0290, 0x5B3E, 0xE085,
-    0x2936, 0x1044, 0x2814, 0x1082, 0x4266, 0x8334, 0x013C, 0x531B,
-    0x0404, 0x0E0D, 0x0C22, 0x0051, 0x0012, 0xC000, 0x0040, 0x8800,
-    0x004A, 0x0000, 0x0000, 0x0000, 0xDFF6, 0x5447, 0x8868, 0x0008,
-    0x0081, 0x0000, 0x0000, 0x4000, 0x0100, 0x0000, 0x0000, 0x0200,
-    0x0600, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0080, 0x0000, 0x0040, 0x0000, 0x0000, 0x0000, 0x1040, 0x0000,
-    0x0000, 0x0000, 0xEFFF, 0xF7FD, 0xFF7F, 0xFFFE, 0xFBFF, 0xFFFF,
-    0xFDFF, 0xBFFF, 0xFFFF, 0x00FF, 0x12C2, 0x0420, 0x0C06, 0x0708,
-    0x1624, 0x0110, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0xE000, 0xFFFE, 0xFFFF, 0xFFFF, 0x7F79, 0x28DF, 0x00F9,
-    0x0C32, 0x8012, 0x0008, 0xD53A, 0xD858, 0xECC2, 0x9D18, 0x2FA8,
-    0x9620, 0xE010, 0xD60C, 0x2622, 0x0F97, 0x0206, 0xB240, 0x9055,
-    0x80A2, 0x5011, 0x9800, 0x0404, 0x4000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFBC0, 0xFFFF,
-    0xEFFE, 0xDFFB, 0x0B08, 0x6243, 0x41B6, 0xFB3B, 0x6F74, 0x2389,
-    0xAE7F, 0xECD7, 0xE047, 0x5960, 0xA096, 0x098F, 0x612C, 0xA030,
-    0x090D, 0x2AAA, 0xD44E, 0x4F7B, 0xC4B2, 0x388B, 0xA9C6, 0x6110,
-    0x0014, 0x4200, 0x800C, 0x0202, 0xFE48, 0x6485, 0xD63E, 0xE3F7,
-    0x3AA0, 0x0C07, 0xE40C, 0x0430, 0xF680, 0x1002, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010,
-    0x4000, 0x0000, 0x4000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4000, 0x0000, 0x0000, 0x0400, 0x0000,
-    0x8000, 0x0000, 0x0000, 0x0000, 0x0400, 0x0040, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x4000, 0x0000, 0x0000, 0x0800, 0x0000,
-    0xFFE0, 0xFEBD, 0xFFFF, 0xFFFF, 0x7F7F, 0xFBE7, 0xFFBF, 0xF7FF,
-    0xFFFF, 0xEFFF, 0xFF7E, 0xDFF7, 0xF6F7, 0xFBDF, 0xBFFE, 0x804F,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xEF00, 0x7FFF,
-    0xFF7F, 0xB6F7, 0x4406, 0xB87E, 0x3BF5, 0x8831, 0x1796, 0x00F4,
-    0xA960, 0x1391, 0x0080, 0x7249, 0xF2F3, 0x0024, 0x8701, 0x42C8,
-    0xE3D3, 0x5048, 0x2400, 0x4305, 0x0000, 0x4A4C, 0x0227, 0x1058,
-    0x2820, 0x0116, 0xA809, 0x0014, 0x0000, 0x0000, 0x3EC0, 0x0068,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0,
-    0xB7FF, 0xFDDB, 0x00F7, 0x0000, 0x4000, 0xC72E, 0x0180, 0x0000,
-    0x2000, 0x0001, 0x4000, 0x0000, 0x0000, 0x0030, 0xFFA8, 0xB4F7,
-    0xADF3, 0x03FF, 0x0120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF000, 0xFFFB,
-    0x9DF7, 0xFDCF, 0x01BF, 0x15C3, 0x1827, 0x810A, 0xA842, 0x0A00,
-    0x8108, 0x8008, 0x8008, 0x1804, 0xA3BE, 0x0012, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9000,
-    0x69E6, 0xDC37, 0x6BFF, 0x3DFF, 0xFCF8, 0xF3F9, 0x0004,
-};
-
-/* Multibyte indexes for URO (U+4E00-U+9FFF) block */
-static const zueci_u16 zueci_gb2312_uro_mb_ind[1263] = {
-      584,   595,   608,   617,   628,   638,   649,   653,
-      657,   665,   674,   687,   693,   706,   717,   725,
-      734,   740,   749,   758,   766,   771,   784,   792,
-      800,   807,   812,   823,   825,   831,   840,   849,
-      854,   857,   864,   873,   876,   882,   885,   887,
-      892,   896,   896,   902,   905,   906,   908,   913,
-      916,   919,   920,   921,   922,   932,   938,   945,
-      957,   965,   972,   979,   989,   997,  1000,  1006,
-     1017,  1027,  1036,  1043,  1053,  1060,  1066,  1072,
-     1075,  1078,  1084,  1094,  1099,  1103,  1108,  1109,
-     1114,  1120,  1127,  1133,  1138,  1147,  1157,  1168,
-     1177,  1185,  1190,  1197,  1200,  1208,  1216,  1229,
-     1241,  1252,  1263,  1275,  1284,  1290,  1301,  1305,
-     1315,  1323,  1332,  1343,  1350,  1362,  1375,  1383,
-     1389,  1394,  1398,  1407,  1414,  1420,  1424,  1433,
-     1440,  1451,  1458,  1459,  1467,  1472,  1480,  1490,
-     1496,  1503,  1507,  1512,  1519,  1522,  1527,  1534,
-     1538,  1542,  1543,  1545,  1547,  1548,  1555,  1561,
-     1570,  1576,  1578,  1586,  1592,  1600,  1609,  1619,
-     1624,  1631,  1634,  1645,  1648,  1653,  1661,  1665,
-     1670,  1676,  1680,  1684,  1686,  1689,  1693,  1696,
-     1697,  1702,  1708,  1710,  1711,  1713,  1715,  1719,
-     1723,  1728,  1735,  1744,  1751,  1760,  1767,  1770,
-     1776,  1785,  1791,  1800,  1804,  1807,  1817,  1821,
-     1824,  1833,  1838,  1842,  1847,  1851,  1853,  1856,
-     1862,  1862,  1865,  1866,  1871,  1875,  1880,  1886,
-     1887,  1888,  1890,  1890,  1893,  1894,  1907,  1915,
-     1921,  1932,  1942,  1951,  1961,  1967,  1973,  1978,
-     1985,  1991,  1999,  2004,  2014,  2024,  2029,  2036,
-     2040,  2045,  2055,  2061,  2068,  2071,  2073,  2080,
-     2082,  2087,  2091,  2097,  2100,  2104,  2107,  2111,
-     2112,  2113,  2115,  2115,  2116,  2118,  2121,  2131,
-     2138,  2146,  2157,  2161,  2167,  2171,  2175,  2177,
-     2187,  2194,  2206,  2211,  2218,  2220,  2225,  2227,
-     2233,  2242,  2249,  2257,  2261,  2262,  2270,  2278,
-     2285,  2296,  2303,  2308,  2312,  2320,  2328,  2336,
-     2343,  2354,  2362,  2372,  2376,  2381,  2387,  2398,
-     2408,  2413,  2420,  2428,  2434,  2438,  2445,  2455,
-     2461,  2469,  2472,  2478,  2479,  2483,  2486,  2489,
-     2492,  2494,  2496,  2500,  2502,  2506,  2509,  2510,
-     2512,  2520,  2530,  2537,  2543,  2553,  2559,  2569,
-     2576,  2580,  2590,  2598,  2605,  2616,  2628,  2639,
-     2648,  2654,  2661,  2671,  2675,  2685,  2689,  2696,
-     2701,  2710,  2714,  2725,  2733,  2739,  2743,  2749,
-     2755,  2762,  2768,  2774,  2778,  2785,  2789,  2792,
-     2795,  2799,  2805,  2810,  2816,  2821,  2826,  2829,
-     2829,  2831,  2833,  2837,  2845,  2850,  2857,  2862,
-     2866,  2869,  2877,  2885,  2889,  2898,  2901,  2912,
-     2917,  2925,  2931,  2937,  2943,  2948,  2956,  2962,
-     2968,  2972,  2976,  2979,  2982,  2982,  2986,  2988,
-     2997,  3003,  3010,  3017,  3022,  3031,  3038,  3046,
-     3054,  3059,  3067,  3076,  3082,  3086,  3097,  3103,
-     3109,  3119,  3124,  3127,  3135,  3147,  3152,  3163,
-     3166,  3171,  3173,  3179,  3182,  3187,  3191,  3194,
-     3200,  3205,  3208,  3211,  3216,  3217,  3222,  3227,
-     3232,  3240,  3245,  3249,  3253,  3257,  3261,  3263,
-     3266,  3267,  3270,  3274,  3278,  3280,  3284,  3286,
-     3289,  3292,  3295,  3299,  3299,  3299,  3299,  3299,
-     3299,  3299,  3299,  3305,  3310,  3315,  3316,  3323,
-     3326,  3336,  3341,  3343,  3348,  3354,  3362,  3366,
-     3370,  3375,  3386,  3396,  3402,  3409,  3418,  3424,
-     3431,  3440,  3446,  3457,  3467,  3472,  3480,  3490,
-     3502,  3508,  3514,  3519,  3528,  3539,  3547,  3554,
-     3558,  3564,  3572,  3584,  3588,  3595,  3601,  3608,
-     3614,  3619,  3626,  3635,  3639,  3643,  3649,  3651,
-     3653,  3658,  3662,  3667,  3675,  3680,  3688,  3696,
-     3698,  3702,  3705,  3712,  3716,  3720,  3723,  3727,
-     3732,  3738,  3739,  3741,  3744,  3747,  3750,  3754,
-     3754,  3754,  3757,  3758,  3760,  3762,  3763,  3767,
-     3774,  3779,  3786,  3791,  3799,  3805,  3809,  3818,
-     3821,  3823,  3830,  3832,  3835,  3839,  3841,  3846,
-     3851,  3854,  3858,  3861,  3864,  3866,  3868,  3872,
-     3873,  3874,  3875,  3878,  3888,  3892,  3898,  3905,
-     3911,  3918,  3920,  3923,  3929,  3936,  3941,  3949,
-     3959,  3963,  3971,  3979,  3986,  3987,  3990,  3994,
-     3995,  4000,  4004,  4009,  4015,  4022,  4026,  4031,
-     4032,  4038,  4041,  4048,  4054,  4055,  4063,  4064,
-     4068,  4074,  4077,  4080,  4081,  4081,  4084,  4091,
-     4095,  4098,  4105,  4112,  4122,  4129,  4134,  4137,
-     4142,  4146,  4155,  4164,  4175,  4184,  4191,  4199,
-     4205,  4211,  4218,  4227,  4235,  4239,  4243,  4246,
-     4250,  4257,  4261,  4263,  4267,  4275,  4284,  4287,
-     4294,  4301,  4304,  4311,  4317,  4321,  4325,  4333,
-     4337,  4343,  4346,  4353,  4359,  4360,  4363,  4372,
-     4378,  4384,  4394,  4401,  4410,  4415,  4421,  4426,
-     4428,  4433,  4441,  4445,  4452,  4457,  4461,  4463,
-     4467,  4469,  4471,  4472,  4477,  4482,  4491,  4498,
-     4501,  4507,  4508,  4509,  4515,  4522,  4527,  4535,
-     4539,  4546,  4550,  4552,  4559,  4560,  4562,  4562,
-     4570,  4577,  4586,  4592,  4594,  4595,  4599,  4605,
-     4609,  4616,  4622,  4631,  4637,  4643,  4652,  4655,
-     4662,  4665,  4671,  4681,  4684,  4688,  4693,  4698,
-     4702,  4706,  4708,  4711,  4713,  4716,  4716,  4716,
-     4721,  4722,  4731,  4736,  4743,  4750,  4756,  4759,
-     4761,  4762,  4762,  4767,  4767,  4767,  4767,  4768,
-     4769,  4769,  4769,  4771,  4771,  4771,  4771,  4771,
-     4771,  4771,  4771,  4771,  4772,  4774,  4774,  4774,
-     4774,  4775,  4777,  4792,  4805,  4821,  4836,  4850,
-     4865,  4880,  4894,  4910,  4919,  4922,  4930,  4936,
-     4941,  4945,  4950,  4954,  4961,  4966,  4970,  4976,
-     4981,  4990,  4999,  5007,  5016,  5023,  5027,  5029,
-     5031,  5039,  5047,  5058,  5067,  5076,  5084,  5095,
-     5105,  5112,  5121,  5123,  5128,  5133,  5140,  5146,
-     5156,  5161,  5166,  5170,  5173,  5180,  5180,  5185,
-     5190,  5198,  5205,  5214,  5225,  5230,  5233,  5236,
-     5245,  5253,  5261,  5273,  5282,  5292,  5303,  5311,
-     5316,  5328,  5335,  5341,  5350,  5356,  5365,  5380,
-     5385,  5389,  5395,  5400,  5412,  5419,  5425,  5430,
-     5436,  5445,  5449,  5454,  5458,  5459,  5465,  5471,
-     5477,  5484,  5487,  5489,  5496,  5501,  5507,  5512,
-     5515,  5516,  5521,  5524,  5531,  5535,  5538,  5540,
-     5546,  5550,  5552,  5557,  5560,  5563,  5567,  5569,
-     5571,  5572,  5574,  5576,  5578,  5581,  5586,  5590,
-     5598,  5605,  5609,  5617,  5623,  5632,  5640,  5644,
-     5652,  5660,  5668,  5674,  5680,  5685,  5688,  5693,
-     5700,  5706,  5709,  5714,  5718,  5722,  5726,  5730,
-     5732,  5734,  5738,  5740,  5743,  5748,  5751,  5761,
-     5767,  5774,  5777,  5781,  5784,  5790,  5796,  5801,
-     5809,  5811,  5817,  5821,  5824,  5826,  5828,  5829,
-     5831,  5834,  5834,  5834,  5834,  5847,  5854,  5859,
-     5860,  5862,  5862,  5862,  5863,  5864,  5864,  5864,
-     5865,  5867,  5868,  5868,  5868,  5868,  5868,  5868,
-     5868,  5869,  5869,  5870,  5870,  5870,  5870,  5872,
-     5872,  5872,  5872,  5887,  5901,  5916,  5931,  5946,
-     5962,  5977,  5992,  6008,  6016,  6021,  6023,  6027,
-     6031,  6036,  6038,  6038,  6038,  6038,  6038,  6038,
-     6038,  6038,  6041,  6056,  6072,  6088,  6100,  6109,
-     6115,  6120,  6123,  6124,  6133,  6140,  6148,  6155,
-     6163,  6168,  6172,  6179,  6184,  6193,  6196,  6201,
-     6207,  6211,  6215,  6218,  6220,  6221,  6221,  6221,
-     6221,  6221,  6221,  6221,  6221,  6221,  6221,  6230,
-     6246,  6260,  6274,  6278,  6284,  6291,  6303,  6313,
-     6319,  6331,  6342,  6349,  6355,  6361,  6368,  6374,
-     6378,  6383,  6390,  6398,  6409,  6416,  6423,  6431,
-     6435,  6437,  6439,  6442,  6444,  6453,  6459,  6469,
-     6481,  6487,  6492,  6498,  6501,  6508,  6510,  6510,
-     6510,  6510,  6510,  6510,  6510,  6510,  6510,  6510,
-     6511,  6512,  6512,  6513,  6513,  6514,  6514,  6514,
-     6514,  6514,  6514,  6514,  6515,  6515,  6515,  6516,
-     6516,  6517,  6517,  6517,  6517,  6518,  6519,  6519,
-     6519,  6519,  6519,  6519,  6520,  6520,  6520,  6521,
-     6521,  6532,  6545,  6561,  6577,  6591,  6604,  6619,
-     6634,  6650,  6665,  6679,  6693,  6706,  6720,  6734,
-     6740,  6740,  6740,  6740,  6740,  6740,  6740,  6747,
-     6762,  6777,  6789,  6793,  6803,  6814,  6819,  6827,
-     6832,  6838,  6844,  6845,  6852,  6863,  6865,  6870,
-     6875,  6885,  6889,  6891,  6896,  6896,  6902,  6907,
-     6911,  6914,  6918,  6923,  6925,  6925,  6925,  6932,
-     6935,  6935,  6935,  6935,  6935,  6935,  6935,  6935,
-     6946,  6960,  6973,  6980,  6980,  6981,  6990,  6992,
-     6992,  6993,  6994,  6995,  6995,  6995,  6997,  7008,
-     7019,  7030,  7040,  7042,  7042,  7042,  7042,  7042,
-     7042,  7042,  7042,  7042,  7042,  7042,  7042,  7046,
-     7061,  7073,  7086,  7094,  7101,  7107,  7111,  7116,
-     7118,  7121,  7123,  7125,  7128,  7138,  7140,  7140,
-     7140,  7140,  7140,  7140,  7140,  7140,  7140,  7140,
-     7140,  7140,  7140,  7140,  7140,  7140,  7140,  7140,
-     7142,  7151,  7161,  7174,  7187,  7198,  7210,
-};
-#endif /* ZUECI_EMBED_NO_TO_ECI */
-
-#ifndef ZUECI_EMBED_NO_TO_ECI
-/* Unicode codepoints sorted */
-static const zueci_u16 zueci_gb2312_u_u[818] = {
-    0x00A4, 0x00A7, 0x00A8, 0x00B0, 0x00B1, 0x00D7, 0x00E0, 0x00E1,
-    0x00E8, 0x00E9, 0x00EA, 0x00EC, 0x00ED, 0x00F2, 0x00F3, 0x00F7,
-    0x00F9, 0x00FA, 0x00FC, 0x0101, 0x0113, 0x011B, 0x012B, 0x014D,
-    0x016B, 0x01CE, 0x01D0, 0x01D2, 0x01D4, 0x01D6, 0x01D8, 0x01DA,
-    0x01DC, 0x02C7, 0x02C9, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
-    0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D,
-    0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6,
-    0x03A7, 0x03A8, 0x03A9, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5,
-    0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD,
-    0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6,
-    0x03C7, 0x03C8, 0x03C9, 0x0401, 0x0410, 0x0411, 0x0412, 0x0413,
-    0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B,
-    0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423,
-    0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B,
-    0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432, 0x0433,
-    0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B,
-    0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443,
-    0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B,
-    0x044C, 0x044D, 0x044E, 0x044F, 0x0451, 0x2015, 0x2016, 0x2018,
-    0x2019, 0x201C, 0x201D, 0x2026, 0x2030, 0x2032, 0x2033, 0x203B,
-    0x2103, 0x2116, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165,
-    0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B, 0x2190, 0x2191,
-    0x2192, 0x2193, 0x2208, 0x220F, 0x2211, 0x221A, 0x221D, 0x221E,
-    0x2220, 0x2225, 0x2227, 0x2228, 0x2229, 0x222A, 0x222B, 0x222E,
-    0x2234, 0x2235, 0x2236, 0x2237, 0x223D, 0x2248, 0x224C, 0x2260,
-    0x2261, 0x2264, 0x2265, 0x226E, 0x226F, 0x2299, 0x22A5, 0x2312,
-    0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
-    0x2468, 0x2469, 0x2474, 0x2475, 0x2476, 0x2477, 0x2478, 0x2479,
-    0x247A, 0x247B, 0x247C, 0x247D, 0x247E, 0x247F, 0x2480, 0x2481,
-    0x2482, 0x2483, 0x2484, 0x2485, 0x2486, 0x2487, 0x2488, 0x2489,
-    0x248A, 0x248B, 0x248C, 0x248D, 0x248E, 0x248F, 0x2490, 0x2491,
-    0x2492, 0x2493, 0x2494, 0x2495, 0x2496, 0x2497, 0x2498, 0x2499,
-    0x249A, 0x249B, 0x2500, 0x2501, 0x2502, 0x2503, 0x2504, 0x2505,
-    0x2506, 0x2507, 0x2508, 0x2509, 0x250A, 0x250B, 0x250C, 0x250D,
-    0x250E, 0x250F, 0x2510, 0x2511, 0x2512, 0x2513, 0x2514, 0x2515,
-    0x2516, 0x2517, 0x2518, 0x2519, 0x251A, 0x251B, 0x251C, 0x251D,
-    0x251E, 0x251F, 0x2520, 0x2521, 0x2522, 0x2523, 0x2524, 0x2525,
-    0x2526, 0x2527, 0x2528, 0x2529, 0x252A, 0x252B, 0x252C, 0x252D,
-    0x252E, 0x252F, 0x2530, 0x2531, 0x2532, 0x2533, 0x2534, 0x2535,
-    0x2536, 0x2537, 0x2538, 0x2539, 0x253A, 0x253B, 0x253C, 0x253D,
-    0x253E, 0x253F, 0x2540, 0x2541, 0x2542, 0x2543, 0x2544, 0x2545,
-    0x2546, 0x2547, 0x2548, 0x2549, 0x254A, 0x254B, 0x25A0, 0x25A1,
-    0x25B2, 0x25B3, 0x25C6, 0x25C7, 0x25CB, 0x25CE, 0x25CF, 0x2605,
-    0x2606, 0x2640, 0x2642, 0x3000, 0x3001, 0x3002, 0x3003, 0x3005,
-    0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E, 0x300F,
-    0x3010, 0x3011, 0x3013, 0x3014, 0x3015, 0x3016, 0x3017, 0x3041,
-    0x3042, 0x3043, 0x3044, 0x3045, 0x3046, 0x3047, 0x3048, 0x3049,
-    0x304A, 0x304B, 0x304C, 0x304D, 0x304E, 0x304F, 0x3050, 0x3051,
-    0x3052, 0x3053, 0x3054, 0x3055, 0x3056, 0x3057, 0x3058, 0x3059,
-    0x305A, 0x305B, 0x305C, 0x305D, 0x305E, 0x305F, 0x3060, 0x3061,
-    0x3062, 0x3063, 0x3064, 0x3065, 0x3066, 0x3067, 0x3068, 0x3069,
-    0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0x306F, 0x3070, 0x3071,
-    0x3072, 0x3073, 0x3074, 0x3075, 0x3076, 0x3077, 0x3078, 0x3079,
-    0x307A, 0x307B, 0x307C, 0x307D, 0x307E, 0x307F, 0x3080, 0x3081,
-    0x3082, 0x3083, 0x3084, 0x3085, 0x3086, 0x3087, 0x3088, 0x3089,
-    0x308A, 0x308B, 0x308C, 0x308D, 0x308E, 0x308F, 0x3090, 0x3091,
-    0x3092, 0x3093, 0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6,
-    0x30A7, 0x30A8, 0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE,
-    0x30AF, 0x30B0, 0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6,
-    0x30B7, 0x30B8, 0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE,
-    0x30BF, 0x30C0, 0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6,
-    0x30C7, 0x30C8, 0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE,
-    0x30CF, 0x30D0, 0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6,
-    0x30D7, 0x30D8, 0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE,
-    0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6,
-    0x30E7, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE,
-    0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6,
-    0x30FB, 0x3105, 0x3106, 0x3107, 0x3108, 0x3109, 0x310A, 0x310B,
-    0x310C, 0x310D, 0x310E, 0x310F, 0x3110, 0x3111, 0x3112, 0x3113,
-    0x3114, 0x3115, 0x3116, 0x3117, 0x3118, 0x3119, 0x311A, 0x311B,
-    0x311C, 0x311D, 0x311E, 0x311F, 0x3120, 0x3121, 0x3122, 0x3123,
-    0x3124, 0x3125, 0x3126, 0x3127, 0x3128, 0x3129, 0x3220, 0x3221,
-    0x3222, 0x3223, 0x3224, 0x3225, 0x3226, 0x3227, 0x3228, 0x3229,
-    0x9E1F, 0x9E20, 0x9E21, 0x9E22, 0x9E23, 0x9E25, 0x9E26, 0x9E28,
-    0x9E29, 0x9E2A, 0x9E2B, 0x9E2C, 0x9E2D, 0x9E2F, 0x9E31, 0x9E32,
-    0x9E33, 0x9E35, 0x9E36, 0x9E37, 0x9E38, 0x9E39, 0x9E3A, 0x9E3D,
-    0x9E3E, 0x9E3F, 0x9E41, 0x9E42, 0x9E43, 0x9E44, 0x9E45, 0x9E46,
-    0x9E47, 0x9E48, 0x9E49, 0x9E4A, 0x9E4B, 0x9E4C, 0x9E4E, 0x9E4F,
-    0x9E51, 0x9E55, 0x9E57, 0x9E58, 0x9E5A, 0x9E5B, 0x9E5C, 0x9E5E,
-    0x9E63, 0x9E64, 0x9E66, 0x9E67, 0x9E68, 0x9E69, 0x9E6A, 0x9E6B,
-    0x9E6C, 0x9E6D, 0x9E70, 0x9E71, 0x9E73, 0x9E7E, 0x9E7F, 0x9E82,
-    0x9E87, 0x9E88, 0x9E8B, 0x9E92, 0x9E93, 0x9E9D, 0x9E9F, 0x9EA6,
-    0x9EB4, 0x9EB8, 0x9EBB, 0x9EBD, 0x9EBE, 0x9EC4, 0x9EC9, 0x9ECD,
-    0x9ECE, 0x9ECF, 0x9ED1, 0x9ED4, 0x9ED8, 0x9EDB, 0x9EDC, 0x9EDD,
-    0x9EDF, 0x9EE0, 0x9EE2, 0x9EE5, 0x9EE7, 0x9EE9, 0x9EEA, 0x9EEF,
-    0x9EF9, 0x9EFB, 0x9EFC, 0x9EFE, 0x9F0B, 0x9F0D, 0x9F0E, 0x9F10,
-    0x9F13, 0x9F17, 0x9F19, 0x9F20, 0x9F22, 0x9F2C, 0x9F2F, 0x9F37,
-    0x9F39, 0x9F3B, 0x9F3D, 0x9F3E, 0x9F44, 0x9F50, 0x9F51, 0x9F7F,
-    0x9F80, 0x9F83, 0x9F84, 0x9F85, 0x9F86, 0x9F87, 0x9F88, 0x9F89,
-    0x9F8A, 0x9F8B, 0x9F8C, 0x9F99, 0x9F9A, 0x9F9B, 0x9F9F, 0x9FA0,
-    0xFF01, 0xFF02, 0xFF03, 0xFF04, 0xFF05, 0xFF06, 0xFF07, 0xFF08,
-    0xFF09, 0xFF0A, 0xFF0B, 0xFF0C, 0xFF0D, 0xFF0E, 0xFF0F, 0xFF10,
-    0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18,
-    0xFF19, 0xFF1A, 0xFF1B, 0xFF1C, 0xFF1D, 0xFF1E, 0xFF1F, 0xFF20,
-    0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28,
-    0xFF29, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30,
-    0xFF31, 0xFF32, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38,
-    0xFF39, 0xFF3A, 0xFF3B, 0xFF3C, 0xFF3D, 0xFF3E, 0xFF3F, 0xFF40,
-    0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48,
-    0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50,
-    0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58,
-    0xFF59, 0xFF5A, 0xFF5B, 0xFF5C, 0xFF5D, 0xFF5E, 0xFFE0, 0xFFE1,
-    0xFFE3, 0xFFE5,
+/* URO (U+4E00-U+9FFF) block rank/select index of pairs of 64-bit usage bit-flags and multibyte index of first
+   codepoint used, interleaved to share a cache line */
+static const unsigned long long zueci_gb2312_uro_rs[632] = {
+    0xEF553DB47F7B7F8BULL,     0, 0x400B0243F35DFBA8ULL,    44, 0x8C2C7BF78D3EFB40ULL,    73,
+    0xA8ED1D3AE3FA6EFFULL,   109, 0x35558CF5CF83E602ULL,   150, 0xD85992B9FFABE048ULL,   182,
+    0x8020D7E92892AB18ULL,   216, 0x450AE74AF583C438ULL,   241, 0x540077629714B000ULL,   270,
+    0xC8C010201420D188ULL,   292, 0x0C0413A800002121ULL,   308, 0x082870C004408000ULL,   321,
+    0x80000002000408C0ULL,   332, 0x3BFB792414722B7BULL,   338, 0x38EF98351AE43327ULL,   373,
+    0xBF69A81328029AD1ULL,   405, 0xAFC96B112FC665CFULL,   433, 0xA00486A25053340FULL,   469,
+    0xC00E3F0FE8090106ULL,   491, 0xC601001081450A88ULL,   515, 0xCE00444B26E1A161ULL,   530,
+    0x85BBCADFD4EEC7AAULL,   554, 0x8840436CA5203A74ULL,   593, 0x3BEFFF798BD23F06ULL,   616,
+    0x5B36FBCBE8EFF75AULL,   657, 0x39EE01541BFD0D49ULL,   700, 0xA91ABFD82E75D855ULL,   731,
+    0xB40C67E0F6BFF3D7ULL,   766, 0xD08BD49D081382C2ULL,   805, 0x59E074F21061065AULL,   830,
+    0x6AAA0080B3128F9FULL,   856, 0x60AC9D7AB05E3230ULL,   883, 0x8A563098C900D303ULL,   912,
+    0x18421F1413907000ULL,   935, 0x108080080008C060ULL,   954, 0xE6332817EC900400ULL,   963,
+    0x4E09F70890000758ULL,   986, 0x18C8AF53FC83F485ULL,  1008, 0x01146ADF080C187CULL,  1040,
+    0x2710A011A734C80CULL,  1064, 0x00210413422228C5ULL,  1086, 0x4000182041123010ULL,  1102,
+    0x10000300C60C022BULL,  1113, 0x0249581000220022ULL,  1127, 0x1792EEB09670A094ULL,  1139,
+    0x2358002505F2CB96ULL,  1167, 0x4A04CF3842CC25DEULL,  1192, 0x8A001128359F0C40ULL,  1220,
+    0x10560229910A13FAULL,  1240, 0x84F0048404200641ULL,  1263, 0x412C04000C040000ULL,  1278,
+    0x00020A4B11541206ULL,  1287, 0x0094000000C00200ULL,  1303, 0x242B167CBFBB0001ULL,  1309,
+    0xE3790C7F7FA89BBBULL,  1337, 0x9F014132E00D10F4ULL,  1377, 0xFF1210B435728652ULL,  1401,
+    0x8602C06B4223CF27ULL,  1430, 0xA1AA3A0C1FD33106ULL,  1456, 0x0801257202040812ULL,  1484,
+    0x601062D0485040CCULL,  1498, 0x00109A0029001C80ULL,  1516, 0x0080000022000004ULL,  1528,
+    0x609ECBE668002020ULL,  1532, 0x398260C03F73916EULL,  1554, 0xBD5C000648301034ULL,  1583,
+    0x43E820E1D6FB8CD1ULL,  1603, 0xC4D00500084E0600ULL,  1634, 0x1602A6E189AA8D1FULL,  1649,
+    0x1A8B365621ED0001ULL,  1677, 0x30A0650213A51FB7ULL,  1701, 0xE9226C9323C7B278ULL,  1728,
+    0x98208FE33A74E47FULL,  1759, 0xBF49BF9C2625280EULL,  1792, 0x1916B949AC543218ULL,  1824,
+    0x0659FBC1B5220C60ULL,  1850, 0x800008D98420E343ULL,  1877, 0x00A1018420225500ULL,  1895,
+    0x4080138020104800ULL,  1908, 0x8020004000160D04ULL,  1918, 0xE09854368DE7FD40ULL,  1928,
+    0xD249FEC8091E7B8BULL,  1959, 0xBA2219378DEE0611ULL,  1992, 0xF0DAF3EC9FDD77F4ULL,  2021,
+    0x26048D3FEC424386ULL,  2064, 0x0CC2628EC021FA6CULL,  2091, 0x559977AD0145D785ULL,  2117,
+    0xA154260B4045E250ULL,  2149, 0xA410344358199827ULL,  2171, 0x07002280411405F2ULL,  2194,
+    0x15A17210426600B4ULL,  2211, 0x0000005441856025ULL,  2232, 0xCB70C82001040201ULL,  2245,
+    0x0095184C6A629320ULL,  2261, 0x3201AAB29A8B1880ULL,  2282, 0x04C3F3E500C4D87AULL,  2305,
+    0x5072A1A1A238D44DULL,  2333, 0x44D1C15284FC980AULL,  2359, 0x4210418020C21094ULL,  2384,
+    0xD29D02403A000000ULL,  2398, 0x2432BD40A8B12F01ULL,  2413, 0xD0ADA723D04BD34DULL,  2438,
+    0x01E9ADAC75A10A92ULL,  2470, 0xA01B9225771F801AULL,  2498, 0x738C060220CADFA1ULL,  2525,
+    0x00D00BFF003B577FULL,  2551, 0x0029A1C40088806AULL,  2582, 0x1623400905242A05ULL,  2598,
+    0xA211201180056822ULL,  2616, 0x1382484964900004ULL,  2632, 0x08922980193023D5ULL,  2648,
+    0xA004200188115402ULL,  2669, 0x6022850281800400ULL,  2682, 0x120200220B010090ULL,  2694,
+    0x00001A0100834011ULL,  2705, 0x0000000000000000ULL,  2715, 0x4684009F00000000ULL,  2715,
+    0x1A0004FC020012C8ULL,  2726, 0x80B804020C4C2EDEULL,  2742, 0x22288C020AFCA826ULL,  2764,
+    0x2135C7D68F7BA0E0ULL,  2786, 0x62550713F8B106C7ULL,  2818, 0xFB0E6EFA8A19936EULL,  2847,
+    0x7DEBCD2F48F91630ULL,  2883, 0x7A2E4CA04E845892ULL,  2918, 0x1190C649561EEDEAULL,  2944,
+    0x8124CFDBE83A5324ULL,  2974, 0x1A8A5853634218F1ULL,  3004, 0x0514AA3B24D37420ULL,  3030,
+    0xC000480089586018ULL,  3055, 0x2CD684A491018268ULL,  3069, 0x02100377C4BA8886ULL,  3091,
+    0x404AAE1100388244ULL,  3114, 0x15146044510028C0ULL,  3132, 0x0248008210007310ULL,  3148,
+    0x0000C00340060205ULL,  3160, 0x022000080C020000ULL,  3170, 0xD161B80040009000ULL,  3176,
+    0x3B8AF80032744621ULL,  3190, 0x2280BBD08B00050FULL,  3215, 0x0043804007690600ULL,  3237,
+    0x250C41D050005420ULL,  3251, 0x0228110183108410ULL,  3267, 0x020040A100304008ULL,  3280,
+    0xABE3150020000040ULL,  3289, 0xC624C2C6AA443180ULL,  3304, 0x03D1B0008004AC13ULL,  3327,
+    0x1D9FF3034285611EULL,  3345, 0xC3925E2678E8440AULL,  3375, 0x4000B00100852000ULL,  3402,
+    0x0C8DCA0488424A90ULL,  3411, 0x000422A14203A705ULL,  3431, 0x107955640C018668ULL,  3448,
+    0x40C12000DEA00002ULL,  3470, 0x040003805001488BULL,  3484, 0x80D0C05D50040000ULL,  3497,
+    0x4DAFBB20970AA010ULL,  3511, 0x831404601E10D921ULL,  3538, 0x733FD83BA6D68848ULL,  3558,
+    0x92130DDC497427BCULL,  3591, 0xD1392E758BA1142BULL,  3621, 0x6900880850503009ULL,  3651,
+    0x80164010024A49D4ULL,  3666, 0x5316C02089D7E564ULL,  3683, 0x15E0A34586002B92ULL,  3710,
+    0xE200196E0C03008BULL,  3733, 0xA82916A580067031ULL,  3753, 0xE1487AAC18802000ULL,  3775,
+    0x5F9132E8B5D63207ULL,  3794, 0x10807C0020E550A1ULL,  3826, 0x421F00AA9D8A7280ULL,  3844,
+    0x0494110002310E22ULL,  3868, 0x5C10001040080022ULL,  3883, 0x0580A1A5FCC80343ULL,  3893,
+    0x6E08008004008433ULL,  3917, 0x2901AAD881262A4BULL,  3931, 0xBA8800094490684DULL,  3955,
+    0x87D1000000820040ULL,  3975, 0x80083161B1E6215BULL,  3986, 0xA600A069C2400800ULL,  4010,
+    0x550A5D714A328D58ULL,  4025, 0x4AA640052D579AA0ULL,  4053, 0x01123FC630B12021ULL,  4078,
+    0x50824462260A10C2ULL,  4100, 0x810004C080409880ULL,  4118, 0x3818000000002003ULL,  4129,
+    0x720E4434F1A60200ULL,  4137, 0x0900810192E035A2ULL,  4159, 0x0000888500000400ULL,  4177,
+    0x0080400000000000ULL,  4183, 0x0000404000000000ULL,  4185, 0x0000000000000000ULL,  4187,
+    0x0800000000000000ULL,  4187, 0x0000000000000082ULL,  4188, 0xE7EFBFFF88000004ULL,  4190,
+    0xFDFFEFEFFFBFFFFFULL,  4221, 0x057FFFFFBFFEFBFFULL,  4281, 0x4216470685B30034ULL,  4335,
+    0xB3058092E4105402ULL,  4357, 0x180B426381305422ULL,  4377, 0xA9EA07E513F5387BULL,  4397,
+    0x8002060005143C4CULL,  4432, 0xF496EE37BD481AD9ULL,  4447, 0x355FBFB27EC0705FULL,  4483,
+    0x41469000455FE644ULL,  4521, 0xFE1362A1063B1D40ULL,  4544, 0x0C08054839028505ULL,  4572,
+    0x581834880000144FULL,  4589, 0x4BFBBD0ED8153077ULL,  4606, 0xE61DC10085008A90ULL,  4641,
+    0x639BFF72B386ED14ULL,  4661, 0x0A92887BD9BEFD92ULL,  4698, 0x177AB9801CB2D3FEULL,  4732,
+    0x3980FFFBDC1782C9ULL,  4766, 0x37DF0F01590C4260ULL,  4801, 0x23070623B15094A3ULL,  4828,
+    0x310201F03102F85AULL,  4852, 0x056A3A0A1E820040ULL,  4874, 0xA714800212805B84ULL,  4893,
+    0x90011069A04B2612ULL,  4912, 0x3F801802848A1000ULL,  4931, 0x4E14011042400708ULL,  4947,
+    0x0281C510180080B0ULL,  4962, 0x8800021010298202ULL,  4976, 0x1100028000420020ULL,  4987,
+    0xFE0258044413E000ULL,  4994, 0x0473979830283C07ULL,  5014, 0x431F6210CB13CED1ULL,  5039,
+    0xC892422E55AC278DULL,  5068, 0x7851403902885380ULL,  5096, 0x2428B9008088292CULL,  5116,
+    0x42004421080E0C41ULL,  5134, 0x1204000608680408ULL,  5148, 0xE0855B3E02903031ULL,  5159,
+    0x1082281410442936ULL,  5183, 0x531B013C83344266ULL,  5200, 0x00510C220E0D0404ULL,  5225,
+    0x88000040C0000012ULL,  5240, 0x000000000000004AULL,  5247, 0x000888685447DFF6ULL,  5250,
+    0x4000000000000081ULL,  5276, 0x0200000000000100ULL,  5279, 0x0000000000080600ULL,  5281,
+    0x0000000000000000ULL,  5284, 0x0000004000000080ULL,  5284, 0x0000104000000000ULL,  5286,
+    0xF7FDEFFF00000000ULL,  5288, 0xFFFFFBFFFFFEFF7FULL,  5317, 0x00FFFFFFBFFFFDFFULL,  5378,
+    0x07080C06042012C2ULL,  5432, 0x0000000001101624ULL,  5447, 0x0000000000000000ULL,  5454,
+    0xFFFFFFFEE0000000ULL,  5454, 0x00F928DF7F79FFFFULL,  5488, 0xD53A000880120C32ULL,  5531,
+    0x2FA89D18ECC2D858ULL,  5549, 0x2622D60CE0109620ULL,  5579, 0x9055B24002060F97ULL,  5600,
+    0x04049800501180A2ULL,  5623, 0x0000000000004000ULL,  5636, 0x0000000000000000ULL,  5637,
+    0xFFFFFBC000000000ULL,  5637, 0x62430B08DFFBEFFEULL,  5662, 0x23896F74FB3B41B6ULL,  5700,
+    0x5960E047ECD7AE7FULL,  5735, 0xA030612C098FA096ULL,  5771, 0x4F7BD44E2AAA090DULL,  5794,
+    0x6110A9C6388BC4B2ULL,  5825, 0x0202800C42000014ULL,  5851, 0xE3F7D63E6485FE48ULL,  5860,
+    0x0430E40C0C073AA0ULL,  5897, 0x000000001002F680ULL,  5917, 0x0000000000000000ULL,  5926,
+    0x0010000000000000ULL,  5926, 0x0000400000004000ULL,  5927, 0x0000000000000100ULL,  5929,
+    0x4000000000000000ULL,  5930, 0x0000040000000000ULL,  5931, 0x0000000000008000ULL,  5932,
+    0x0000000000400400ULL,  5933, 0x4000000000000000ULL,  5935, 0x0000080000000000ULL,  5936,
+    0xFFFFFFFFFEBDFFE0ULL,  5937, 0xF7FFFFBFFBE77F7FULL,  5993, 0xDFF7FF7EEFFFFFFFULL,  6050,
+    0x804FBFFEFBDFF6F7ULL,  6109, 0x0000000000000000ULL,  6156, 0x7FFFEF0000000000ULL,  6156,
+    0xB87E4406B6F7FF7FULL,  6178, 0x00F4179688313BF5ULL,  6219, 0x724900801391A960ULL,  6248,
+    0x42C887010024F2F3ULL,  6268, 0x430524005048E3D3ULL,  6291, 0x105802274A4C0000ULL,  6312,
+    0x0014A80901162820ULL,  6327, 0x00683EC000000000ULL,  6341, 0x0000000000000000ULL,  6351,
+    0xFFE0000000000000ULL,  6351, 0x000000F7FDDBB7FFULL,  6362, 0x00000180C72E4000ULL,  6396,
+    0x0000400000012000ULL,  6408, 0xB4F7FFA800300000ULL,  6411, 0x0000012003FFADF3ULL,  6435,
+    0x0000000000000000ULL,  6458, 0x0000000000000000ULL,  6458, 0xFFFBF00000000000ULL,  6458,
+    0x15C301BFFDCF9DF7ULL,  6477, 0x0A00A842810A1827ULL,  6517, 0x1804800880088108ULL,  6534,
+    0x000000000012A3BEULL,  6544, 0x0000000000000000ULL,  6556, 0x0000000000000000ULL,  6556,
+    0x0000000000000000ULL,  6556, 0x9000000000000000ULL,  6556, 0x3DFF6BFFDC3769E6ULL,  6558,
+    0x00000004F3F9FCF8ULL,  6603,
 };
 #endif /* ZUECI_EMBED_NO_TO_ECI */
 
 #ifndef ZUECI_EMBED_NO_TO_ECI
-/* Multibyte values sorted in Unicode order */
-static const zueci_u16 zueci_gb2312_u_mb[7445] = {
-    0xA1E8, 0xA1EC, 0xA1A7, 0xA1E3, 0xA1C0, 0xA1C1, 0xA8A4, 0xA8A2,
-    0xA8A8, 0xA8A6, 0xA8BA, 0xA8AC, 0xA8AA, 0xA8B0, 0xA8AE, 0xA1C2,
-    0xA8B4, 0xA8B2, 0xA8B9, 0xA8A1, 0xA8A5, 0xA8A7, 0xA8A9, 0xA8AD,
-    0xA8B1, 0xA8A3, 0xA8AB, 0xA8AF, 0xA8B3, 0xA8B5, 0xA8B6, 0xA8B7,
-    0xA8B8, 0xA1A6, 0xA1A5, 0xA6A1, 0xA6A2, 0xA6A3, 0xA6A4, 0xA6A5,
-    0xA6A6, 0xA6A7, 0xA6A8, 0xA6A9, 0xA6AA, 0xA6AB, 0xA6AC, 0xA6AD,
-    0xA6AE, 0xA6AF, 0xA6B0, 0xA6B1, 0xA6B2, 0xA6B3, 0xA6B4, 0xA6B5,
-    0xA6B6, 0xA6B7, 0xA6B8, 0xA6C1, 0xA6C2, 0xA6C3, 0xA6C4, 0xA6C5,
-    0xA6C6, 0xA6C7, 0xA6C8, 0xA6C9, 0xA6CA, 0xA6CB, 0xA6CC, 0xA6CD,
-    0xA6CE, 0xA6CF, 0xA6D0, 0xA6D1, 0xA6D2, 0xA6D3, 0xA6D4, 0xA6D5,
-    0xA6D6, 0xA6D7, 0xA6D8, 0xA7A7, 0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4,
-    0xA7A5, 0xA7A6, 0xA7A8, 0xA7A9, 0xA7AA, 0xA7AB, 0xA7AC, 0xA7AD,
-    0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1, 0xA7B2, 0xA7B3, 0xA7B4, 0xA7B5,
-    0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9, 0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD,
-    0xA7BE, 0xA7BF, 0xA7C0, 0xA7C1, 0xA7D1, 0xA7D2, 0xA7D3, 0xA7D4,
-    0xA7D5, 0xA7D6, 0xA7D8, 0xA7D9, 0xA7DA, 0xA7DB, 0xA7DC, 0xA7DD,
-    0xA7DE, 0xA7DF, 0xA7E0, 0xA7E1, 0xA7E2, 0xA7E3, 0xA7E4, 0xA7E5,
-    0xA7E6, 0xA7E7, 0xA7E8, 0xA7E9, 0xA7EA, 0xA7EB, 0xA7EC, 0xA7ED,
-    0xA7EE, 0xA7EF, 0xA7F0, 0xA7F1, 0xA7D7, 0xA1AA, 0xA1AC, 0xA1AE,
-    0xA1AF, 0xA1B0, 0xA1B1, 0xA1AD, 0xA1EB, 0xA1E4, 0xA1E5, 0xA1F9,
-    0xA1E6, 0xA1ED, 0xA2F1, 0xA2F2, 0xA2F3, 0xA2F4, 0xA2F5, 0xA2F6,
-    0xA2F7, 0xA2F8, 0xA2F9, 0xA2FA, 0xA2FB, 0xA2FC, 0xA1FB, 0xA1FC,
-    0xA1FA, 0xA1FD, 0xA1CA, 0xA1C7, 0xA1C6, 0xA1CC, 0xA1D8, 0xA1DE,
-    0xA1CF, 0xA1CE, 0xA1C4, 0xA1C5, 0xA1C9, 0xA1C8, 0xA1D2, 0xA1D3,
-    0xA1E0, 0xA1DF, 0xA1C3, 0xA1CB, 0xA1D7, 0xA1D6, 0xA1D5, 0xA1D9,
-    0xA1D4, 0xA1DC, 0xA1DD, 0xA1DA, 0xA1DB, 0xA1D1, 0xA1CD, 0xA1D0,
-    0xA2D9, 0xA2DA, 0xA2DB, 0xA2DC, 0xA2DD, 0xA2DE, 0xA2DF, 0xA2E0,
-    0xA2E1, 0xA2E2, 0xA2C5, 0xA2C6, 0xA2C7, 0xA2C8, 0xA2C9, 0xA2CA,
-    0xA2CB, 0xA2CC, 0xA2CD, 0xA2CE, 0xA2CF, 0xA2D0, 0xA2D1, 0xA2D2,
-    0xA2D3, 0xA2D4, 0xA2D5, 0xA2D6, 0xA2D7, 0xA2D8, 0xA2B1, 0xA2B2,
-    0xA2B3, 0xA2B4, 0xA2B5, 0xA2B6, 0xA2B7, 0xA2B8, 0xA2B9, 0xA2BA,
-    0xA2BB, 0xA2BC, 0xA2BD, 0xA2BE, 0xA2BF, 0xA2C0, 0xA2C1, 0xA2C2,
-    0xA2C3, 0xA2C4, 0xA9A4, 0xA9A5, 0xA9A6, 0xA9A7, 0xA9A8, 0xA9A9,
-    0xA9AA, 0xA9AB, 0xA9AC, 0xA9AD, 0xA9AE, 0xA9AF, 0xA9B0, 0xA9B1,
-    0xA9B2, 0xA9B3, 0xA9B4, 0xA9B5, 0xA9B6, 0xA9B7, 0xA9B8, 0xA9B9,
-    0xA9BA, 0xA9BB, 0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0, 0xA9C1,
-    0xA9C2, 0xA9C3, 0xA9C4, 0xA9C5, 0xA9C6, 0xA9C7, 0xA9C8, 0xA9C9,
-    0xA9CA, 0xA9CB, 0xA9CC, 0xA9CD, 0xA9CE, 0xA9CF, 0xA9D0, 0xA9D1,
-    0xA9D2, 0xA9D3, 0xA9D4, 0xA9D5, 0xA9D6, 0xA9D7, 0xA9D8, 0xA9D9,
-    0xA9DA, 0xA9DB, 0xA9DC, 0xA9DD, 0xA9DE, 0xA9DF, 0xA9E0, 0xA9E1,
-    0xA9E2, 0xA9E3, 0xA9E4, 0xA9E5, 0xA9E6, 0xA9E7, 0xA9E8, 0xA9E9,
-    0xA9EA, 0xA9EB, 0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0xA1F6, 0xA1F5,
-    0xA1F8, 0xA1F7, 0xA1F4, 0xA1F3, 0xA1F0, 0xA1F2, 0xA1F1, 0xA1EF,
-    0xA1EE, 0xA1E2, 0xA1E1, 0xA1A1, 0xA1A2, 0xA1A3, 0xA1A8, 0xA1A9,
-    0xA1B4, 0xA1B5, 0xA1B6, 0xA1B7, 0xA1B8, 0xA1B9, 0xA1BA, 0xA1BB,
-    0xA1BE, 0xA1BF, 0xA1FE, 0xA1B2, 0xA1B3, 0xA1BC, 0xA1BD, 0xA4A1,
-    0xA4A2, 0xA4A3, 0xA4A4, 0xA4A5, 0xA4A6, 0xA4A7, 0xA4A8, 0xA4A9,
-    0xA4AA, 0xA4AB, 0xA4AC, 0xA4AD, 0xA4AE, 0xA4AF, 0xA4B0, 0xA4B1,
-    0xA4B2, 0xA4B3, 0xA4B4, 0xA4B5, 0xA4B6, 0xA4B7, 0xA4B8, 0xA4B9,
-    0xA4BA, 0xA4BB, 0xA4BC, 0xA4BD, 0xA4BE, 0xA4BF, 0xA4C0, 0xA4C1,
-    0xA4C2, 0xA4C3, 0xA4C4, 0xA4C5, 0xA4C6, 0xA4C7, 0xA4C8, 0xA4C9,
-    0xA4CA, 0xA4CB, 0xA4CC, 0xA4CD, 0xA4CE, 0xA4CF, 0xA4D0, 0xA4D1,
-    0xA4D2, 0xA4D3, 0xA4D4, 0xA4D5, 0xA4D6, 0xA4D7, 0xA4D8, 0xA4D9,
-    0xA4DA, 0xA4DB, 0xA4DC, 0xA4DD, 0xA4DE, 0xA4DF, 0xA4E0, 0xA4E1,
-    0xA4E2, 0xA4E3, 0xA4E4, 0xA4E5, 0xA4E6, 0xA4E7, 0xA4E8, 0xA4E9,
-    0xA4EA, 0xA4EB, 0xA4EC, 0xA4ED, 0xA4EE, 0xA4EF, 0xA4F0, 0xA4F1,
-    0xA4F2, 0xA4F3, 0xA5A1, 0xA5A2, 0xA5A3, 0xA5A4, 0xA5A5, 0xA5A6,
-    0xA5A7, 0xA5A8, 0xA5A9, 0xA5AA, 0xA5AB, 0xA5AC, 0xA5AD, 0xA5AE,
-    0xA5AF, 0xA5B0, 0xA5B1, 0xA5B2, 0xA5B3, 0xA5B4, 0xA5B5, 0xA5B6,
-    0xA5B7, 0xA5B8, 0xA5B9, 0xA5BA, 0xA5BB, 0xA5BC, 0xA5BD, 0xA5BE,
-    0xA5BF, 0xA5C0, 0xA5C1, 0xA5C2, 0xA5C3, 0xA5C4, 0xA5C5, 0xA5C6,
-    0xA5C7, 0xA5C8, 0xA5C9, 0xA5CA, 0xA5CB, 0xA5CC, 0xA5CD, 0xA5CE,
-    0xA5CF, 0xA5D0, 0xA5D1, 0xA5D2, 0xA5D3, 0xA5D4, 0xA5D5, 0xA5D6,
-    0xA5D7, 0xA5D8, 0xA5D9, 0xA5DA, 0xA5DB, 0xA5DC, 0xA5DD, 0xA5DE,
-    0xA5DF, 0xA5E0, 0xA5E1, 0xA5E2, 0xA5E3, 0xA5E4, 0xA5E5, 0xA5E6,
-    0xA5E7, 0xA5E8, 0xA5E9, 0xA5EA, 0xA5EB, 0xA5EC, 0xA5ED, 0xA5EE,
-    0xA5EF, 0xA5F0, 0xA5F1, 0xA5F2, 0xA5F3, 0xA5F4, 0xA5F5, 0xA5F6,
-    0xA1A4, 0xA8C5, 0xA8C6, 0xA8C7, 0xA8C8, 0xA8C9, 0xA8CA, 0xA8CB,
-    0xA8CC, 0xA8CD, 0xA8CE, 0xA8CF, 0xA8D0, 0xA8D1, 0xA8D2, 0xA8D3,
-    0xA8D4, 0xA8D5, 0xA8D6, 0xA8D7, 0xA8D8, 0xA8D9, 0xA8DA, 0xA8DB,
-    0xA8DC, 0xA8DD, 0xA8DE, 0xA8DF, 0xA8E0, 0xA8E1, 0xA8E2, 0xA8E3,
-    0xA8E4, 0xA8E5, 0xA8E6, 0xA8E7, 0xA8E8, 0xA8E9, 0xA2E5, 0xA2E6,
-    0xA2E7, 0xA2E8, 0xA2E9, 0xA2EA, 0xA2EB, 0xA2EC, 0xA2ED, 0xA2EE,
+/* URO multibyte values sorted in Unicode order */
+static const zueci_u16 zueci_gb2312_u_mb[6627] = {
     0xD2BB, 0xB6A1, 0xC6DF, 0xCDF2, 0xD5C9, 0xC8FD, 0xC9CF, 0xCFC2,
     0xD8A2, 0xB2BB, 0xD3EB, 0xD8A4, 0xB3F3, 0xD7A8, 0xC7D2, 0xD8A7,
     0xCAC0, 0xC7F0, 0xB1FB, 0xD2B5, 0xB4D4, 0xB6AB, 0xCBBF, 0xD8A9,
@@ -1349,74 +954,299 @@ static const zueci_u16 zueci_gb2312_u_mb[7445] = {
     0xF6F6, 0xF6F7, 0xF6F8, 0xC8FA, 0xF6F9, 0xF6FA, 0xF6FB, 0xF6FC,
     0xF6FD, 0xF6FE, 0xF7A1, 0xF7A2, 0xF7A3, 0xF7A4, 0xF7A5, 0xF7A6,
     0xF7A7, 0xF7A8, 0xB1EE, 0xF7A9, 0xF7AA, 0xF7AB, 0xF7AC, 0xF7AD,
-    0xC1DB, 0xF7AE, 0xF7AF, 0xC4F1, 0xF0AF, 0xBCA6, 0xF0B0, 0xC3F9,
-    0xC5B8, 0xD1BB, 0xF0B1, 0xF0B2, 0xF0B3, 0xF0B4, 0xF0B5, 0xD1BC,
-    0xD1EC, 0xF0B7, 0xF0B6, 0xD4A7, 0xCDD2, 0xF0B8, 0xF0BA, 0xF0B9,
-    0xF0BB, 0xF0BC, 0xB8EB, 0xF0BD, 0xBAE8, 0xF0BE, 0xF0BF, 0xBEE9,
-    0xF0C0, 0xB6EC, 0xF0C1, 0xF0C2, 0xF0C3, 0xF0C4, 0xC8B5, 0xF0C5,
-    0xF0C6, 0xF0C7, 0xC5F4, 0xF0C8, 0xF0C9, 0xF0CA, 0xF7BD, 0xF0CB,
-    0xF0CC, 0xF0CD, 0xF0CE, 0xF0CF, 0xBAD7, 0xF0D0, 0xF0D1, 0xF0D2,
-    0xF0D3, 0xF0D4, 0xF0D5, 0xF0D6, 0xF0D8, 0xD3A5, 0xF0D7, 0xF0D9,
-    0xF5BA, 0xC2B9, 0xF7E4, 0xF7E5, 0xF7E6, 0xF7E7, 0xF7E8, 0xC2B4,
-    0xF7EA, 0xF7EB, 0xC2F3, 0xF4F0, 0xF4EF, 0xC2E9, 0xF7E1, 0xF7E2,
-    0xBBC6, 0xD9E4, 0xCAF2, 0xC0E8, 0xF0A4, 0xBADA, 0xC7AD, 0xC4AC,
-    0xF7EC, 0xF7ED, 0xF7EE, 0xF7F0, 0xF7EF, 0xF7F1, 0xF7F4, 0xF7F3,
-    0xF7F2, 0xF7F5, 0xF7F6, 0xEDE9, 0xEDEA, 0xEDEB, 0xF6BC, 0xF6BD,
-    0xF6BE, 0xB6A6, 0xD8BE, 0xB9C4, 0xD8BB, 0xDCB1, 0xCAF3, 0xF7F7,
-    0xF7F8, 0xF7F9, 0xF7FB, 0xF7FA, 0xB1C7, 0xF7FC, 0xF7FD, 0xF7FE,
-    0xC6EB, 0xECB4, 0xB3DD, 0xF6B3, 0xF6B4, 0xC1E4, 0xF6B5, 0xF6B6,
-    0xF6B7, 0xF6B8, 0xF6B9, 0xF6BA, 0xC8A3, 0xF6BB, 0xC1FA, 0xB9A8,
-    0xEDE8, 0xB9EA, 0xD9DF, 0xA3A1, 0xA3A2, 0xA3A3, 0xA1E7, 0xA3A5,
-    0xA3A6, 0xA3A7, 0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD,
-    0xA3AE, 0xA3AF, 0xA3B0, 0xA3B1, 0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5,
-    0xA3B6, 0xA3B7, 0xA3B8, 0xA3B9, 0xA3BA, 0xA3BB, 0xA3BC, 0xA3BD,
-    0xA3BE, 0xA3BF, 0xA3C0, 0xA3C1, 0xA3C2, 0xA3C3, 0xA3C4, 0xA3C5,
-    0xA3C6, 0xA3C7, 0xA3C8, 0xA3C9, 0xA3CA, 0xA3CB, 0xA3CC, 0xA3CD,
-    0xA3CE, 0xA3CF, 0xA3D0, 0xA3D1, 0xA3D2, 0xA3D3, 0xA3D4, 0xA3D5,
-    0xA3D6, 0xA3D7, 0xA3D8, 0xA3D9, 0xA3DA, 0xA3DB, 0xA3DC, 0xA3DD,
-    0xA3DE, 0xA3DF, 0xA3E0, 0xA3E1, 0xA3E2, 0xA3E3, 0xA3E4, 0xA3E5,
-    0xA3E6, 0xA3E7, 0xA3E8, 0xA3E9, 0xA3EA, 0xA3EB, 0xA3EC, 0xA3ED,
-    0xA3EE, 0xA3EF, 0xA3F0, 0xA3F1, 0xA3F2, 0xA3F3, 0xA3F4, 0xA3F5,
-    0xA3F6, 0xA3F7, 0xA3F8, 0xA3F9, 0xA3FA, 0xA3FB, 0xA3FC, 0xA3FD,
-    0xA1AB, 0xA1E9, 0xA1EA, 0xA3FE, 0xA3A4,
+    0xC1DB, 0xF7AE, 0xF7AF,
 };
 #endif /* ZUECI_EMBED_NO_TO_ECI */
 
 #ifndef ZUECI_EMBED_NO_TO_ECI
-/* Indexes into Unicode `zueci_gb2312_u_u[]` array in blocks of 0x100 */
-static const zueci_u16 zueci_gb2312_u_ind[256] = {
-        0,    25,    33,    53,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      149,   149,   149,   149,   149,   149,   149,   149,
-      160,   178,   206,   208,   258,   336,   347,   347,
-      347,   347,   347,   347,   347,   347,   347,   347,
-      453,   574,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   584,   584,
-      584,   584,   584,   584,   584,   584,   655,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   720,
-      720,   720,   720,   720,   720,   720,   720,   814,
+/* Non-URO page directory indexed by `u >> 8` of pages in `zueci_gb2312_pg[]` (page 0 empty) */
+static const unsigned char zueci_gb2312_pg_dir[256] = {
+        1,     2,     3,     4,     5,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        6,     7,     8,     9,    10,    11,    12,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+       13,    14,    15,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,    16,    17,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,    18,
+};
+
+/* Non-URO pages of 16 indexes by `(u >> 4) & 0xF` of blocks in `zueci_gb2312_pg_mb[]` (block 0 empty) */
+static const unsigned char zueci_gb2312_pg[304] = {
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     1,     2,     0,     3,     4,     5,
+        6,     7,     8,     0,     9,     0,    10,     0,
+        0,     0,     0,     0,    11,    12,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,    13,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    14,    15,    16,    17,     0,     0,     0,
+       18,    19,    20,    21,    22,    23,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    24,    25,    26,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+       27,    28,     0,     0,     0,     0,    29,     0,
+        0,    30,     0,     0,     0,     0,     0,     0,
+       31,    32,    33,    34,    35,     0,    36,     0,
+        0,    37,    38,     0,     0,     0,     0,     0,
+        0,    39,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,    40,    41,
+       42,    43,     0,     0,     0,     0,     0,     0,
+       44,    45,    46,    47,    48,     0,     0,     0,
+        0,     0,    49,    50,    51,     0,     0,     0,
+       52,     0,     0,     0,    53,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+       54,    55,     0,     0,    56,    57,    58,    59,
+       60,    61,    62,    63,    64,    65,    66,    67,
+       68,    69,    70,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,    71,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,
+        0,    72,    73,    74,    75,    76,    77,    78,
+       79,    80,    81,    82,    83,    84,    85,    86,
+       87,    88,    89,    90,    91,    92,     0,    93,
+       94,    95,    96,     0,     0,     0,     0,     0,
+       97,    98,    99,   100,   101,   102,     0,     0,
+        0,     0,     0,     0,     0,     0,   103,     0,
+};
+
+/* Non-URO blocks of 16 multibyte values by `u & 0xF`, 0 if none */
+static const zueci_u16 zueci_gb2312_pg_mb[1664] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA1E8, 0x0000, 0x0000, 0xA1EC,
+    0xA1A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1E3, 0xA1C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA8A4, 0xA8A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA8A8, 0xA8A6, 0xA8BA, 0x0000, 0xA8AC, 0xA8AA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA8B0, 0xA8AE, 0x0000, 0x0000, 0x0000, 0xA1C2,
+    0x0000, 0xA8B4, 0xA8B2, 0x0000, 0xA8B9, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA8A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8A5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8A7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8A9, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8AD, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA8B1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8A3, 0x0000,
+    0xA8AB, 0x0000, 0xA8AF, 0x0000, 0xA8B3, 0x0000, 0xA8B5, 0x0000,
+    0xA8B6, 0x0000, 0xA8B7, 0x0000, 0xA8B8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1A6,
+    0x0000, 0xA1A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA6A1, 0xA6A2, 0xA6A3, 0xA6A4, 0xA6A5, 0xA6A6, 0xA6A7,
+    0xA6A8, 0xA6A9, 0xA6AA, 0xA6AB, 0xA6AC, 0xA6AD, 0xA6AE, 0xA6AF,
+    0xA6B0, 0xA6B1, 0x0000, 0xA6B2, 0xA6B3, 0xA6B4, 0xA6B5, 0xA6B6,
+    0xA6B7, 0xA6B8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA6C1, 0xA6C2, 0xA6C3, 0xA6C4, 0xA6C5, 0xA6C6, 0xA6C7,
+    0xA6C8, 0xA6C9, 0xA6CA, 0xA6CB, 0xA6CC, 0xA6CD, 0xA6CE, 0xA6CF,
+    0xA6D0, 0xA6D1, 0x0000, 0xA6D2, 0xA6D3, 0xA6D4, 0xA6D5, 0xA6D6,
+    0xA6D7, 0xA6D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA7A7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA7A1, 0xA7A2, 0xA7A3, 0xA7A4, 0xA7A5, 0xA7A6, 0xA7A8, 0xA7A9,
+    0xA7AA, 0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7AF, 0xA7B0, 0xA7B1,
+    0xA7B2, 0xA7B3, 0xA7B4, 0xA7B5, 0xA7B6, 0xA7B7, 0xA7B8, 0xA7B9,
+    0xA7BA, 0xA7BB, 0xA7BC, 0xA7BD, 0xA7BE, 0xA7BF, 0xA7C0, 0xA7C1,
+    0xA7D1, 0xA7D2, 0xA7D3, 0xA7D4, 0xA7D5, 0xA7D6, 0xA7D8, 0xA7D9,
+    0xA7DA, 0xA7DB, 0xA7DC, 0xA7DD, 0xA7DE, 0xA7DF, 0xA7E0, 0xA7E1,
+    0xA7E2, 0xA7E3, 0xA7E4, 0xA7E5, 0xA7E6, 0xA7E7, 0xA7E8, 0xA7E9,
+    0xA7EA, 0xA7EB, 0xA7EC, 0xA7ED, 0xA7EE, 0xA7EF, 0xA7F0, 0xA7F1,
+    0x0000, 0xA7D7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1AA, 0xA1AC, 0x0000,
+    0xA1AE, 0xA1AF, 0x0000, 0x0000, 0xA1B0, 0xA1B1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1AD, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1EB, 0x0000, 0xA1E4, 0xA1E5, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA1F9, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA1E6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1ED, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA2F1, 0xA2F2, 0xA2F3, 0xA2F4, 0xA2F5, 0xA2F6, 0xA2F7, 0xA2F8,
+    0xA2F9, 0xA2FA, 0xA2FB, 0xA2FC, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1FB, 0xA1FC, 0xA1FA, 0xA1FD, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1CA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1C7,
+    0x0000, 0xA1C6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA1CC, 0x0000, 0x0000, 0xA1D8, 0xA1DE, 0x0000,
+    0xA1CF, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CE, 0x0000, 0xA1C4,
+    0xA1C5, 0xA1C9, 0xA1C8, 0xA1D2, 0x0000, 0x0000, 0xA1D3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA1E0, 0xA1DF, 0xA1C3, 0xA1CB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1D7, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1D6, 0x0000, 0x0000, 0x0000, 0xA1D5, 0x0000, 0x0000, 0x0000,
+    0xA1D9, 0xA1D4, 0x0000, 0x0000, 0xA1DC, 0xA1DD, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1DA, 0xA1DB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA1D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1CD, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA1D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA2D9, 0xA2DA, 0xA2DB, 0xA2DC, 0xA2DD, 0xA2DE, 0xA2DF, 0xA2E0,
+    0xA2E1, 0xA2E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xA2C5, 0xA2C6, 0xA2C7, 0xA2C8,
+    0xA2C9, 0xA2CA, 0xA2CB, 0xA2CC, 0xA2CD, 0xA2CE, 0xA2CF, 0xA2D0,
+    0xA2D1, 0xA2D2, 0xA2D3, 0xA2D4, 0xA2D5, 0xA2D6, 0xA2D7, 0xA2D8,
+    0xA2B1, 0xA2B2, 0xA2B3, 0xA2B4, 0xA2B5, 0xA2B6, 0xA2B7, 0xA2B8,
+    0xA2B9, 0xA2BA, 0xA2BB, 0xA2BC, 0xA2BD, 0xA2BE, 0xA2BF, 0xA2C0,
+    0xA2C1, 0xA2C2, 0xA2C3, 0xA2C4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA9A4, 0xA9A5, 0xA9A6, 0xA9A7, 0xA9A8, 0xA9A9, 0xA9AA, 0xA9AB,
+    0xA9AC, 0xA9AD, 0xA9AE, 0xA9AF, 0xA9B0, 0xA9B1, 0xA9B2, 0xA9B3,
+    0xA9B4, 0xA9B5, 0xA9B6, 0xA9B7, 0xA9B8, 0xA9B9, 0xA9BA, 0xA9BB,
+    0xA9BC, 0xA9BD, 0xA9BE, 0xA9BF, 0xA9C0, 0xA9C1, 0xA9C2, 0xA9C3,
+    0xA9C4, 0xA9C5, 0xA9C6, 0xA9C7, 0xA9C8, 0xA9C9, 0xA9CA, 0xA9CB,
+    0xA9CC, 0xA9CD, 0xA9CE, 0xA9CF, 0xA9D0, 0xA9D1, 0xA9D2, 0xA9D3,
+    0xA9D4, 0xA9D5, 0xA9D6, 0xA9D7, 0xA9D8, 0xA9D9, 0xA9DA, 0xA9DB,
+    0xA9DC, 0xA9DD, 0xA9DE, 0xA9DF, 0xA9E0, 0xA9E1, 0xA9E2, 0xA9E3,
+    0xA9E4, 0xA9E5, 0xA9E6, 0xA9E7, 0xA9E8, 0xA9E9, 0xA9EA, 0xA9EB,
+    0xA9EC, 0xA9ED, 0xA9EE, 0xA9EF, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1F6, 0xA1F5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xA1F8, 0xA1F7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1F4, 0xA1F3,
+    0x0000, 0x0000, 0x0000, 0xA1F0, 0x0000, 0x0000, 0xA1F2, 0xA1F1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA1EF, 0xA1EE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1E2, 0x0000, 0xA1E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA1A1, 0xA1A2, 0xA1A3, 0xA1A8, 0x0000, 0xA1A9, 0x0000, 0x0000,
+    0xA1B4, 0xA1B5, 0xA1B6, 0xA1B7, 0xA1B8, 0xA1B9, 0xA1BA, 0xA1BB,
+    0xA1BE, 0xA1BF, 0x0000, 0xA1FE, 0xA1B2, 0xA1B3, 0xA1BC, 0xA1BD,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA4A1, 0xA4A2, 0xA4A3, 0xA4A4, 0xA4A5, 0xA4A6, 0xA4A7,
+    0xA4A8, 0xA4A9, 0xA4AA, 0xA4AB, 0xA4AC, 0xA4AD, 0xA4AE, 0xA4AF,
+    0xA4B0, 0xA4B1, 0xA4B2, 0xA4B3, 0xA4B4, 0xA4B5, 0xA4B6, 0xA4B7,
+    0xA4B8, 0xA4B9, 0xA4BA, 0xA4BB, 0xA4BC, 0xA4BD, 0xA4BE, 0xA4BF,
+    0xA4C0, 0xA4C1, 0xA4C2, 0xA4C3, 0xA4C4, 0xA4C5, 0xA4C6, 0xA4C7,
+    0xA4C8, 0xA4C9, 0xA4CA, 0xA4CB, 0xA4CC, 0xA4CD, 0xA4CE, 0xA4CF,
+    0xA4D0, 0xA4D1, 0xA4D2, 0xA4D3, 0xA4D4, 0xA4D5, 0xA4D6, 0xA4D7,
+    0xA4D8, 0xA4D9, 0xA4DA, 0xA4DB, 0xA4DC, 0xA4DD, 0xA4DE, 0xA4DF,
+    0xA4E0, 0xA4E1, 0xA4E2, 0xA4E3, 0xA4E4, 0xA4E5, 0xA4E6, 0xA4E7,
+    0xA4E8, 0xA4E9, 0xA4EA, 0xA4EB, 0xA4EC, 0xA4ED, 0xA4EE, 0xA4EF,
+    0xA4F0, 0xA4F1, 0xA4F2, 0xA4F3, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA5A1, 0xA5A2, 0xA5A3, 0xA5A4, 0xA5A5, 0xA5A6, 0xA5A7,
+    0xA5A8, 0xA5A9, 0xA5AA, 0xA5AB, 0xA5AC, 0xA5AD, 0xA5AE, 0xA5AF,
+    0xA5B0, 0xA5B1, 0xA5B2, 0xA5B3, 0xA5B4, 0xA5B5, 0xA5B6, 0xA5B7,
+    0xA5B8, 0xA5B9, 0xA5BA, 0xA5BB, 0xA5BC, 0xA5BD, 0xA5BE, 0xA5BF,
+    0xA5C0, 0xA5C1, 0xA5C2, 0xA5C3, 0xA5C4, 0xA5C5, 0xA5C6, 0xA5C7,
+    0xA5C8, 0xA5C9, 0xA5CA, 0xA5CB, 0xA5CC, 0xA5CD, 0xA5CE, 0xA5CF,
+    0xA5D0, 0xA5D1, 0xA5D2, 0xA5D3, 0xA5D4, 0xA5D5, 0xA5D6, 0xA5D7,
+    0xA5D8, 0xA5D9, 0xA5DA, 0xA5DB, 0xA5DC, 0xA5DD, 0xA5DE, 0xA5DF,
+    0xA5E0, 0xA5E1, 0xA5E2, 0xA5E3, 0xA5E4, 0xA5E5, 0xA5E6, 0xA5E7,
+    0xA5E8, 0xA5E9, 0xA5EA, 0xA5EB, 0xA5EC, 0xA5ED, 0xA5EE, 0xA5EF,
+    0xA5F0, 0xA5F1, 0xA5F2, 0xA5F3, 0xA5F4, 0xA5F5, 0xA5F6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xA1A4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA8C5, 0xA8C6, 0xA8C7,
+    0xA8C8, 0xA8C9, 0xA8CA, 0xA8CB, 0xA8CC, 0xA8CD, 0xA8CE, 0xA8CF,
+    0xA8D0, 0xA8D1, 0xA8D2, 0xA8D3, 0xA8D4, 0xA8D5, 0xA8D6, 0xA8D7,
+    0xA8D8, 0xA8D9, 0xA8DA, 0xA8DB, 0xA8DC, 0xA8DD, 0xA8DE, 0xA8DF,
+    0xA8E0, 0xA8E1, 0xA8E2, 0xA8E3, 0xA8E4, 0xA8E5, 0xA8E6, 0xA8E7,
+    0xA8E8, 0xA8E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xA2E5, 0xA2E6, 0xA2E7, 0xA2E8, 0xA2E9, 0xA2EA, 0xA2EB, 0xA2EC,
+    0xA2ED, 0xA2EE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC4F1,
+    0xF0AF, 0xBCA6, 0xF0B0, 0xC3F9, 0x0000, 0xC5B8, 0xD1BB, 0x0000,
+    0xF0B1, 0xF0B2, 0xF0B3, 0xF0B4, 0xF0B5, 0xD1BC, 0x0000, 0xD1EC,
+    0x0000, 0xF0B7, 0xF0B6, 0xD4A7, 0x0000, 0xCDD2, 0xF0B8, 0xF0BA,
+    0xF0B9, 0xF0BB, 0xF0BC, 0x0000, 0x0000, 0xB8EB, 0xF0BD, 0xBAE8,
+    0x0000, 0xF0BE, 0xF0BF, 0xBEE9, 0xF0C0, 0xB6EC, 0xF0C1, 0xF0C2,
+    0xF0C3, 0xF0C4, 0xC8B5, 0xF0C5, 0xF0C6, 0x0000, 0xF0C7, 0xC5F4,
+    0x0000, 0xF0C8, 0x0000, 0x0000, 0x0000, 0xF0C9, 0x0000, 0xF0CA,
+    0xF7BD, 0x0000, 0xF0CB, 0xF0CC, 0xF0CD, 0x0000, 0xF0CE, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF0CF, 0xBAD7, 0x0000, 0xF0D0, 0xF0D1,
+    0xF0D2, 0xF0D3, 0xF0D4, 0xF0D5, 0xF0D6, 0xF0D8, 0x0000, 0x0000,
+    0xD3A5, 0xF0D7, 0x0000, 0xF0D9, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF5BA, 0xC2B9,
+    0x0000, 0x0000, 0xF7E4, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7E5,
+    0xF7E6, 0x0000, 0x0000, 0xF7E7, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0xF7E8, 0xC2B4, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7EA, 0x0000, 0xF7EB,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC2F3, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF4F0, 0x0000, 0x0000, 0x0000,
+    0xF4EF, 0x0000, 0x0000, 0xC2E9, 0x0000, 0xF7E1, 0xF7E2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xBBC6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xD9E4, 0x0000, 0x0000, 0x0000, 0xCAF2, 0xC0E8, 0xF0A4,
+    0x0000, 0xBADA, 0x0000, 0x0000, 0xC7AD, 0x0000, 0x0000, 0x0000,
+    0xC4AC, 0x0000, 0x0000, 0xF7EC, 0xF7ED, 0xF7EE, 0x0000, 0xF7F0,
+    0xF7EF, 0x0000, 0xF7F1, 0x0000, 0x0000, 0xF7F4, 0x0000, 0xF7F3,
+    0x0000, 0xF7F2, 0xF7F5, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7F6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xEDE9, 0x0000, 0xEDEA, 0xEDEB, 0x0000, 0xF6BC, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0xF6BD, 0x0000, 0xF6BE, 0xB6A6, 0x0000,
+    0xD8BE, 0x0000, 0x0000, 0xB9C4, 0x0000, 0x0000, 0x0000, 0xD8BB,
+    0x0000, 0xDCB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xCAF3, 0x0000, 0xF7F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF7F8, 0x0000, 0x0000, 0xF7F9,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF7FB,
+    0x0000, 0xF7FA, 0x0000, 0xB1C7, 0x0000, 0xF7FC, 0xF7FD, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0xF7FE, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0xC6EB, 0xECB4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB3DD,
+    0xF6B3, 0x0000, 0x0000, 0xF6B4, 0xC1E4, 0xF6B5, 0xF6B6, 0xF6B7,
+    0xF6B8, 0xF6B9, 0xF6BA, 0xC8A3, 0xF6BB, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xC1FA, 0xB9A8, 0xEDE8, 0x0000, 0x0000, 0x0000, 0xB9EA,
+    0xD9DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xA3A1, 0xA3A2, 0xA3A3, 0xA1E7, 0xA3A5, 0xA3A6, 0xA3A7,
+    0xA3A8, 0xA3A9, 0xA3AA, 0xA3AB, 0xA3AC, 0xA3AD, 0xA3AE, 0xA3AF,
+    0xA3B0, 0xA3B1, 0xA3B2, 0xA3B3, 0xA3B4, 0xA3B5, 0xA3B6, 0xA3B7,
+    0xA3B8, 0xA3B9, 0xA3BA, 0xA3BB, 0xA3BC, 0xA3BD, 0xA3BE, 0xA3BF,
+    0xA3C0, 0xA3C1, 0xA3C2, 0xA3C3, 0xA3C4, 0xA3C5, 0xA3C6, 0xA3C7,
+    0xA3C8, 0xA3C9, 0xA3CA, 0xA3CB, 0xA3CC, 0xA3CD, 0xA3CE, 0xA3CF,
+    0xA3D0, 0xA3D1, 0xA3D2, 0xA3D3, 0xA3D4, 0xA3D5, 0xA3D6, 0xA3D7,
+    0xA3D8, 0xA3D9, 0xA3DA, 0xA3DB, 0xA3DC, 0xA3DD, 0xA3DE, 0xA3DF,
+    0xA3E0, 0xA3E1, 0xA3E2, 0xA3E3, 0xA3E4, 0xA3E5, 0xA3E6, 0xA3E7,
+    0xA3E8, 0xA3E9, 0xA3EA, 0xA3EB, 0xA3EC, 0xA3ED, 0xA3EE, 0xA3EF,
+    0xA3F0, 0xA3F1, 0xA3F2, 0xA3F3, 0xA3F4, 0xA3F5, 0xA3F6, 0xA3F7,
+    0xA3F8, 0xA3F9, 0xA3FA, 0xA3FB, 0xA3FC, 0xA3FD, 0xA1AB, 0x0000,
+    0xA1E9, 0xA1EA, 0x0000, 0xA3FE, 0x0000, 0xA3A4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
 };
 #endif /* ZUECI_EMBED_NO_TO_ECI */
 
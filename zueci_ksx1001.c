@@ -0,0 +1,95 @@
+/*  zueci_ksx1001.c - ECI 30 EUC-KR (KS X 1001, formerly KS C 5601) Korean */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <assert.h>
+
+#include "zueci.h"
+#include "zueci_common.h"
+
+#if ZUECI_HAS_ECI(30)
+#include "zueci_mb.h"
+#include "zueci_ksx1001.h"
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Unicode to ECI 30 EUC-KR (KS X 1001, formerly KS C 5601) Korean */
+ZUECI_INTERN int zueci_u_ksx1001(const zueci_u32 u, unsigned char *dest) {
+    if (u < 0x80) {
+        dest[0] = (unsigned char) u;
+        return 1;
+    }
+    /* Special case URO block sequential mappings (considerably lessens size of `zueci_ksx1001_pg_mb[]` array) */
+    if (u >= 0x4E00 && u < 0xAC00) { /* 0xAC00 next used value >= 0x4E00 */
+        if (u >= 0x9FA0) {
+            return 0;
+        }
+        return zueci_u_lookup_uro(u, zueci_ksx1001_uro_rs, zueci_ksx1001_u_mb, dest);
+    }
+    /* Hangul syllables, a subset of which map in order to rows 0xB0-0xC8 */
+    if (u >= 0xAC00 && u <= 0xD7A3) {
+        const unsigned long long *rs = zueci_ksx1001_hangul_rs + (((u - 0xAC00) >> 6) << 1); /* Blocks of 64 */
+        const unsigned long long v = (unsigned long long) 1 << (u & 0x3F); /* 0xAC00 a multiple of 64 */
+        int ind;
+        if ((rs[0] & v) == 0) {
+            return 0;
+        }
+        ind = (int) rs[1] + zueci_popcount64(rs[0] & (v - 1)); /* Rank of bits prior to this one */
+        dest[0] = (unsigned char) (0xB0 + ind / (0xFF - 0xA1));
+        dest[1] = (unsigned char) (0xA1 + ind % (0xFF - 0xA1));
+        return 2;
+    }
+    return zueci_u_lookup_pg(u, zueci_ksx1001_pg_dir, zueci_ksx1001_pg, zueci_ksx1001_pg_mb, dest);
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_ksx1001_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_ksx1001(u, dest);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* ECI 30 EUC-KR to Unicode */
+ZUECI_INTERN int zueci_ksx1001_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2;
+    int ind;
+    zueci_u32 u2;
+
+    (void)flags;
+    assert(len);
+
+    c1 = src[0];
+    if (c1 < 0x80) {
+        *p_u = c1;
+        return 1;
+    }
+    if (len < 2 || c1 < 0xA1 || (c1 > 0xAC && c1 < 0xB0) || c1 == 0xC9 || c1 > 0xFD) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 < 0xA1 || c2 == 0xFF) {
+        return 0;
+    }
+    ind = (0xFF - 0xA1) * (c1 - 0xA1 - (c1 > 0xAC) * 3 - (c1 > 0xC9)) + c2 - 0xA1;
+    assert(ind < ZUECI_ASIZE(zueci_ksx1001_mb_u));
+    if ((u2 = zueci_ksx1001_mb_u[ind])) {
+        *p_u = u2;
+        return 2;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_ksx1001_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_ksx1001_u(src, len, flags, p_u);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+#endif /* ZUECI_HAS_ECI(30) */
+
+/* vim: set ts=4 sw=4 et : */
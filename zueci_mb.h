@@ -0,0 +1,64 @@
+/*  zueci_mb.h - shared multibyte lookup helpers */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef ZUECI_MB_H
+#define ZUECI_MB_H
+
+/* Acknowledgements to Bruno Haible <bruno@clisp.org> for a no. of techniques used here */
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Number of bits set in `v` */
+static int zueci_popcount64(const unsigned long long v) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__POPCNT__) || defined(__aarch64__))
+    return __builtin_popcountll(v); /* Single instruction (otherwise may be a library call) */
+#else
+    /* Count bits set (http://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel) */
+    unsigned long long w = v - ((v >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    return (int) ((((w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/* Helper to lookup Unicode codepoint `u` in the URO (Unified Repertoire and Ordering) block (U+4E00-9FFF) using
+   rank/select index `tab_uro_rs` of interleaved 64-bit usage bit-flags and multibyte indexes */
+static int zueci_u_lookup_uro(const zueci_u32 u, const unsigned long long *tab_uro_rs, const zueci_u16 *tab_u_mb,
+            unsigned char *dest) {
+    const unsigned long long *rs = tab_uro_rs + (((u - 0x4E00) >> 6) << 1); /* Blocks of 64 */
+    const unsigned long long v = (unsigned long long) 1 << (u & 0x3F); /* 0x4E00 a multiple of 64 */
+    zueci_u16 mb;
+    if ((rs[0] & v) == 0) {
+        return 0;
+    }
+    mb = tab_u_mb[rs[1] + zueci_popcount64(rs[0] & (v - 1))]; /* Rank of bits prior to this one */
+    dest[0] = (unsigned char) (mb >> 8);
+    dest[1] = (unsigned char) mb;
+    return 2;
+}
+
+/* Helper to lookup non-URO Unicode codepoint `u` in the two-level page table `pg_dir`, `pg`, `pg_mb`, returning 1
+   for single-byte values (Shift JIS only) */
+static int zueci_u_lookup_pg(const zueci_u32 u, const unsigned char *pg_dir, const unsigned char *pg,
+            const zueci_u16 *pg_mb, unsigned char *dest) {
+    zueci_u16 mb;
+    if (u > 0xFFFF) {
+        return 0;
+    }
+    if (!(mb = pg_mb[(pg[(pg_dir[u >> 8] << 4) | ((u >> 4) & 0xF)] << 4) | (u & 0xF)])) {
+        return 0;
+    }
+    if (mb <= 0xFF) {
+        dest[0] = (unsigned char) mb;
+        return 1;
+    }
+    dest[0] = (unsigned char) (mb >> 8);
+    dest[1] = (unsigned char) mb;
+    return 2;
+}
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+/* vim: set ts=4 sw=4 et : */
+#endif /* ZUECI_MB_H */
@@ -0,0 +1,102 @@
+/*  zueci_sjis.c - ECI 20 Shift JIS */
+/*
+    libzueci - an open source UTF-8 ECI library adapted from libzint
+    Copyright (C) 2022 gitlost
+ */
+/* SPDX-License-Identifier: BSD-3-Clause */
+
+#include <assert.h>
+
+#include "zueci.h"
+#include "zueci_common.h"
+
+#if ZUECI_HAS_ECI(20)
+#include "zueci_mb.h"
+#include "zueci_sjis.h"
+
+#ifndef ZUECI_EMBED_NO_TO_ECI
+/* Unicode to ECI 20 Shift JIS */
+ZUECI_INTERN int zueci_u_sjis(const zueci_u32 u, unsigned char *dest) {
+    if (u < 0x80 && u != 0x5C && u != 0x7E) { /* Backslash & tilde re-mapped according to JIS X 0201 Roman */
+        dest[0] = (unsigned char) u;
+        return 1;
+    }
+    /* Special case URO block sequential mappings (considerably lessens size of `zueci_sjis_pg_mb[]` array) */
+    if (u >= 0x4E00 && u < 0xE000) { /* 0xE000 next used value >= 0x4E00 */
+        if (u > 0x9FA0) {
+            return 0;
+        }
+        return zueci_u_lookup_uro(u, zueci_sjis_uro_rs, zueci_sjis_u_mb, dest);
+    }
+    /* PUA to user-defined (Table 4-86, Lunde, 2nd ed.) */
+    if (u >= 0xE000 && u <= 0xE757) {
+        const zueci_u32 u2 = u - 0xE000;
+        const unsigned char dv = (unsigned char) (u2 / (0xFC - 0x40));
+        const unsigned char md = (unsigned char) (u2 - dv * (0xFC - 0x40));
+        dest[0] = dv + 0xF0;
+        dest[1] = md + 0x40 + (md >= 0x3F);
+        return 2;
+    }
+    return zueci_u_lookup_pg(u, zueci_sjis_pg_dir, zueci_sjis_pg, zueci_sjis_pg_mb, dest);
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_u_sjis_test(const zueci_u32 u, unsigned char *dest) {
+    return zueci_u_sjis(u, dest);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_ECI */
+
+#ifndef ZUECI_EMBED_NO_TO_UTF8
+/* ECI 20 Shift JIS to Unicode */
+ZUECI_INTERN int zueci_sjis_u(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    unsigned char c1, c2;
+    int ind;
+    zueci_u32 u2;
+
+    assert(len);
+    c1 = src[0];
+    if (c1 < 0x80) {
+        if (c1 == 0x5C) { /* Backslash to Yen sign */
+            *p_u = (flags & ZUECI_FLAG_SJIS_STRAIGHT_THRU) ? c1 : 0xA5;
+        } else if (c1 == 0x7E) { /* Tilde to overline */
+            *p_u = (flags & ZUECI_FLAG_SJIS_STRAIGHT_THRU) ? c1 : 0x203E;
+        } else {
+            *p_u = c1;
+        }
+        return 1;
+    }
+    if (c1 >= 0xA1 && c1 <= 0xDF) { /* Half-width katakana */
+        *p_u = 0xFEC0 + c1;
+        return 1;
+    }
+    if (len < 2 || c1 == 0x80 || c1 == 0xA0 || (c1 > 0xEA && c1 < 0xF0) || c1 > 0xF9) {
+        return 0;
+    }
+    c2 = src[1];
+    if (c2 < 0x40 || c2 == 0x7F || c2 > 0xFC) {
+        return 0;
+    }
+    if (c1 >= 0xF0 && c1 <= 0xF9) { /* User-defined to PUA (Table 4-86, Lunde, 2nd ed.) */
+        *p_u = 0xE000 + (0xFC - 0x40) * (c1 - 0xF0) + c2 - 0x40 - (c2 > 0x7F);
+        return 2;
+    }
+    ind = (0xFC - 0x40) * (c1 - 0x81 - (c1 > 0xA0) * (0xE0 - 0xA0)) + c2 - 0x40 - (c2 > 0x7F);
+    if (ind < ZUECI_ASIZE(zueci_sjis_mb_u) && (u2 = zueci_sjis_mb_u[ind])) {
+        *p_u = u2;
+        return 2;
+    }
+    return 0;
+}
+
+#ifdef ZUECI_TEST /* Wrapper for direct testing */
+ZUECI_INTERN int zueci_sjis_u_test(const unsigned char *src, const zueci_u32 len, const unsigned int flags,
+                    zueci_u32 *p_u) {
+    return zueci_sjis_u(src, len, flags, p_u);
+}
+#endif
+#endif /* ZUECI_EMBED_NO_TO_UTF8 */
+#endif /* ZUECI_HAS_ECI(20) */
+
+/* vim: set ts=4 sw=4 et : */